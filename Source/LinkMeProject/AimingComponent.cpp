@@ -5,6 +5,7 @@
 #include "Camera/CameraComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "DrawDebugHelpers.h"
+#include "Components/ViewQueryComponent.h"
 
 UAimingComponent::UAimingComponent()
 {
@@ -16,6 +17,41 @@ UAimingComponent::UAimingComponent()
 void UAimingComponent::BeginPlay()
 {
 	Super::BeginPlay();
+
+	// Find or create the shared view query
+	AActor* Owner = GetOwner();
+	if (!Owner) return;
+
+	ViewQuery = Owner->FindComponentByClass<UViewQueryComponent>();
+	if (!ViewQuery)
+	{
+		ViewQuery = NewObject<UViewQueryComponent>(Owner, TEXT("ViewQuery"));
+		if (ViewQuery)
+		{
+			ViewQuery->RegisterComponent();
+		}
+	}
+
+	if (ViewQuery)
+	{
+		AimQuery = ViewQuery->AddQuery(AimingTraceChannel, AimingRadius, MaxRange);
+	}
+}
+
+bool UAimingComponent::GetView(FVector& OutLocation, FRotator& OutRotation) const
+{
+	if (ViewQuery && ViewQuery->GetResult(AimQuery).bValid)
+	{
+		OutLocation = ViewQuery->GetResult(AimQuery).ViewLocation;
+		OutRotation = ViewQuery->GetResult(AimQuery).ViewRotation;
+		return true;
+	}
+
+	APlayerController* PC = UGameplayStatics::GetPlayerController(this, 0);
+	if (!PC) return false;
+
+	PC->GetPlayerViewPoint(OutLocation, OutRotation);
+	return true;
 }
 
 void UAimingComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -33,47 +69,20 @@ void UAimingComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActo
 		return;
 	}
 
-	// Perform trace from Camera center
-	APlayerController* PC = UGameplayStatics::GetPlayerController(this, 0);
-	if (!PC) return;
+	// The camera ray is traced once per frame by the shared view query
+	if (!ViewQuery) return;
 
-	FVector CamLoc;
-	FRotator CamRot;
-	PC->GetPlayerViewPoint(CamLoc, CamRot);
+	// Channel / radius / MaxRange may have been edited at runtime
+	ViewQuery->UpdateQuery(AimQuery, AimingTraceChannel, AimingRadius, MaxRange);
 
-	const FVector Start = CamLoc;
+	const FViewQueryResult& View = ViewQuery->GetResult(AimQuery);
+	if (!View.bValid) return;
+	const FRotator CamRot = View.ViewRotation;
+	const FVector Start = View.ViewLocation;
 	const FVector End = Start + (CamRot.Vector() * MaxRange);
 
-	FHitResult Hit;
-	FCollisionQueryParams Params;
-	Params.AddIgnoredActor(GetOwner());
-	
-	// Also ignore all components attached to owner (mesh, capsule, etc.)
-	if (AActor* Owner = GetOwner())
-	{
-		TArray<UActorComponent*> Components;
-		Owner->GetComponents(Components);
-		for (UActorComponent* Comp : Components)
-		{
-			if (UPrimitiveComponent* PrimComp = Cast<UPrimitiveComponent>(Comp))
-			{
-				Params.AddIgnoredComponent(PrimComp);
-			}
-		}
-	}
-
-	bool bHit = false;
-
-	// Use SphereTrace if Radius is defined
-	if (AimingRadius > 0.0f)
-	{
-		FCollisionShape Sphere = FCollisionShape::MakeSphere(AimingRadius);
-		bHit = GetWorld()->SweepSingleByChannel(Hit, Start, End, FQuat::Identity, AimingTraceChannel, Sphere, Params);
-	}
-	else
-	{
-		bHit = GetWorld()->LineTraceSingleByChannel(Hit, Start, End, AimingTraceChannel, Params);
-	}
+	const FHitResult& Hit = View.Hit;
+	const bool bHit = View.HasHitWithin(MaxRange);
 
 	// Debug Draw & Verbose Logs
 	if (bShowDebug)
@@ -157,16 +166,13 @@ FVector UAimingComponent::GetTargetLocation() const
 
 FVector UAimingComponent::GetAimDirection() const
 {
-	APlayerController* PC = UGameplayStatics::GetPlayerController(this, 0);
-	if (!PC) 
+	FVector CamLoc;
+	FRotator CamRot;
+	if (!GetView(CamLoc, CamRot))
 	{
 		return FVector::ForwardVector;
 	}
 
-	FVector CamLoc;
-	FRotator CamRot;
-	PC->GetPlayerViewPoint(CamLoc, CamRot);
-
 	// If we have a valid target, aim towards it
 	if (bHasValidTarget)
 	{
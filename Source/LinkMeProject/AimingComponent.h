@@ -50,6 +50,9 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Aiming")
 	float AimingRadius = 0.0f;
 
+	/** Channel of the aim ray (head look follows it to share the same trace) */
+	ECollisionChannel GetAimingTraceChannel() const { return AimingTraceChannel; }
+
 	/** If true, enables Verbose Logs and Visual Debugging (Lines/Spheres) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Debug")
 	bool bShowDebug = false;
@@ -81,4 +84,14 @@ protected:
 	// Internal tracker to prevent spamming delegates
 	UPROPERTY()
 	AActor* CurrentTargetActor;
+
+	/** Shared per-frame camera ray (found or created at BeginPlay) */
+	UPROPERTY(Transient)
+	class UViewQueryComponent* ViewQuery = nullptr;
+
+	/** Handle of the aim ray in ViewQuery */
+	int32 AimQuery = INDEX_NONE;
+
+	/** Camera view from the shared query, or the player view point as fallback */
+	bool GetView(FVector& OutLocation, FRotator& OutRotation) const;
 };
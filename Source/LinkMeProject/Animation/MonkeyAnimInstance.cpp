@@ -40,26 +40,46 @@ void UMonkeyAnimInstance::NativeUpdateAnimation(float DeltaSeconds) {
     return;
   }
 
-  // Pull frequently-changing values each frame
+  // Game thread: copy what the worker update needs, nothing else.
+  // Everything derived is computed in NativeThreadSafeUpdateAnimation.
   CurrentStrideLength = CachedCharacter->GetCurrentStrideLength();
+  SnapshotVelocity = CachedCharacter->GetVelocity();
+
+  // Sprint speed of the current stance (Quad default)
+  SnapshotSprintSpeed = (Stance == EMonkeyStance::Biped)
+                            ? CachedCharacter->BipedSpeeds.Z
+                            : CachedCharacter->QuadrupedSpeeds.Z;
+
+  // Falling state
+  if (UCharacterMovementComponent *CMC =
+          CachedCharacter->GetCharacterMovement()) {
+    bIsFalling = CMC->IsFalling();
+  }
+
+  // Copy Procedural Animation Data (single struct copy)
+  ProceduralData = CachedCharacter->ProceduralData;
+
+  // Copy Inertia State from InertialMovementComponent (Phase 2 - Updated V2)
+  if (UInertialMovementComponent *InertialComp =
+          CachedCharacter->InertialMovementComp) {
+    BodyInertia = InertialComp->GetBodyInertia();
+    HeadLook = InertialComp->GetHeadLook();
+  }
+}
+
+void UMonkeyAnimInstance::NativeThreadSafeUpdateAnimation(float DeltaSeconds) {
+  Super::NativeThreadSafeUpdateAnimation(DeltaSeconds);
+
+  // Worker thread: only the snapshot above and our own members
 
   // Speed (horizontal velocity)
-  Speed = CachedCharacter->GetVelocity().Size2D();
+  Speed = SnapshotVelocity.Size2D();
 
   // Calculate GaitAlpha (0-1) based on Stance
   // 0 = Walk, 1 = Sprint
   // Use 90% of MaxSpeed as divisor to ensure GaitAlpha reaches 1.0 before
   // actual max
-  float MaxSpeed = 0.0f;
-  if (Stance == EMonkeyStance::Biped) {
-    MaxSpeed = CachedCharacter->BipedSpeeds.Z; // Sprint speed
-  } else {
-    MaxSpeed =
-        CachedCharacter->QuadrupedSpeeds.Z; // Sprint speed (Quad default)
-  }
-
-  // Apply 10% buffer: divide by 90% of MaxSpeed
-  const float EffectiveMaxSpeed = MaxSpeed * 0.9f;
+  const float EffectiveMaxSpeed = SnapshotSprintSpeed * 0.9f;
   if (EffectiveMaxSpeed > 0.0f) {
     GaitAlpha = FMath::Clamp(Speed / EffectiveMaxSpeed, 0.0f, 1.0f);
   } else {
@@ -69,12 +89,6 @@ void UMonkeyAnimInstance::NativeUpdateAnimation(float DeltaSeconds) {
   // GaitIndex for Blend Poses by Int: 0 = Walk, 1 = Run
   GaitIndex = (GaitAlpha >= 1.0f) ? 1 : 0;
 
-  // Falling state
-  if (UCharacterMovementComponent *CMC =
-          CachedCharacter->GetCharacterMovement()) {
-    bIsFalling = CMC->IsFalling();
-  }
-
   // ===================================================================
   // STRIDE PHASE CALCULATION (with phase preservation)
   // ===================================================================
@@ -105,16 +119,6 @@ void UMonkeyAnimInstance::NativeUpdateAnimation(float DeltaSeconds) {
 
   // Calculate ExplicitTime for Sequence Evaluator
   ExplicitTime = StridePhase * AnimCycleDuration;
-
-  // Copy Procedural Animation Data (single struct copy)
-  ProceduralData = CachedCharacter->ProceduralData;
-
-  // Copy Inertia State from InertialMovementComponent (Phase 2 - Updated V2)
-  if (UInertialMovementComponent *InertialComp =
-          CachedCharacter->InertialMovementComp) {
-    BodyInertia = InertialComp->GetBodyInertia();
-    HeadLook = InertialComp->GetHeadLook();
-  }
 }
 
 void UMonkeyAnimInstance::OnStanceUpdated(EMonkeyStance OldStance,
@@ -17,7 +17,8 @@ enum class EMonkeyStance : uint8;
 /**
  * Custom AnimInstance for Monkey character.
  * Caches locomotion state from ACharacterRope via delegate (push) and polling
- * (pull).
+ * (pull). The game thread only copies raw values; gait and stride math run
+ * in NativeThreadSafeUpdateAnimation on the animation worker threads.
  */
 UCLASS()
 class LINKMEPROJECT_API UMonkeyAnimInstance : public UAnimInstance {
@@ -97,6 +98,7 @@ protected:
   virtual void NativeInitializeAnimation() override;
   virtual void NativeUninitializeAnimation() override;
   virtual void NativeUpdateAnimation(float DeltaSeconds) override;
+  virtual void NativeThreadSafeUpdateAnimation(float DeltaSeconds) override;
 
 private:
   // ===================================================================
@@ -112,7 +114,17 @@ private:
   TWeakObjectPtr<ACharacterRope> CachedCharacter;
 
   // ===================================================================
-  // STRIDE TRACKING (Internal)
+  // GAME THREAD SNAPSHOT (written in NativeUpdateAnimation only)
+  // ===================================================================
+
+  /** Character velocity */
+  FVector SnapshotVelocity = FVector::ZeroVector;
+
+  /** Sprint speed of the current stance (GaitAlpha reference) */
+  float SnapshotSprintSpeed = 0.0f;
+
+  // ===================================================================
+  // STRIDE TRACKING (Internal, worker thread)
   // ===================================================================
 
   /** Total distance traveled (used for StridePhase calculation) */
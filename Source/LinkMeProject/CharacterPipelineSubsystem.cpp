@@ -0,0 +1,206 @@
+// CharacterPipelineSubsystem.cpp
+
+#include "CharacterPipelineSubsystem.h"
+#include "AimingComponent.h"
+#include "Async/ParallelFor.h"
+#include "CharacterRope.h"
+#include "Components/InertialMovementComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/SpringArmComponent.h"
+#include "HookChargeComponent.h"
+#include "LinkMeProject.h"
+#include "RopeRenderComponent.h"
+
+DECLARE_CYCLE_STAT(TEXT("Character Post-Movement"), STAT_CharacterPostMovement,
+                   STATGROUP_LinkMe);
+
+namespace {
+
+// Below this many stepping characters the batch stays on the game thread
+constexpr int32 MinParallelBatch = 4;
+
+} // namespace
+
+void FCharacterPipelineTickFunction::ExecuteTick(
+    float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread,
+    const FGraphEventRef &MyCompletionGraphEvent) {
+  if (Pipeline && TickType != LEVELTICK_ViewportsOnly) {
+    Pipeline->TickPostMovement(DeltaTime);
+  }
+}
+
+FString FCharacterPipelineTickFunction::DiagnosticMessage() {
+  return TEXT("UCharacterPipelineSubsystem::TickPostMovement");
+}
+
+// ===================================================================
+// LIFECYCLE
+// ===================================================================
+
+bool UCharacterPipelineSubsystem::DoesSupportWorldType(
+    const EWorldType::Type WorldType) const {
+  return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UCharacterPipelineSubsystem::OnWorldBeginPlay(UWorld &InWorld) {
+  Super::OnWorldBeginPlay(InWorld);
+
+  PostMovementTick.Pipeline = this;
+  PostMovementTick.bCanEverTick = true;
+  PostMovementTick.bStartWithTickEnabled = true;
+  PostMovementTick.TickGroup = TG_PostPhysics;
+  PostMovementTick.RegisterTickFunction(InWorld.PersistentLevel);
+}
+
+void UCharacterPipelineSubsystem::Deinitialize() {
+  if (PostMovementTick.IsTickFunctionRegistered()) {
+    PostMovementTick.UnRegisterTickFunction();
+  }
+  Entries.Reset();
+
+  Super::Deinitialize();
+}
+
+// ===================================================================
+// REGISTRATION
+// ===================================================================
+
+void UCharacterPipelineSubsystem::RegisterCharacter(
+    ACharacterRope *Character) {
+  FTickFunction &ActorTick = Character->PrimaryActorTick;
+
+  // 1. Input: actor tick (locomotion, stance), then charge and aim
+  UHookChargeComponent *Charge =
+      Character->FindComponentByClass<UHookChargeComponent>();
+  UAimingComponent *Aiming =
+      Character->FindComponentByClass<UAimingComponent>();
+  if (Charge) {
+    Charge->PrimaryComponentTick.AddPrerequisite(Character, ActorTick);
+  }
+  if (Aiming) {
+    Aiming->PrimaryComponentTick.AddPrerequisite(Character, ActorTick);
+  }
+
+  // 2. Rope gameplay: sees this frame's input
+  URopeSystemComponent *Rope =
+      Character->FindComponentByClass<URopeSystemComponent>();
+  if (Rope) {
+    Rope->PrimaryComponentTick.AddPrerequisite(Character, ActorTick);
+    if (Charge) {
+      Rope->PrimaryComponentTick.AddPrerequisite(
+          Charge, Charge->PrimaryComponentTick);
+    }
+    if (Aiming) {
+      Rope->PrimaryComponentTick.AddPrerequisite(
+          Aiming, Aiming->PrimaryComponentTick);
+    }
+  }
+
+  // 3. Movement: integrates the rope forces / velocity projection
+  UCharacterMovementComponent *MoveComp = Character->GetCharacterMovement();
+  if (MoveComp && Rope) {
+    MoveComp->PrimaryComponentTick.AddPrerequisite(
+        Rope, Rope->PrimaryComponentTick);
+  }
+
+  // 4. Post-movement visuals: inertia joins the batch
+  if (UInertialMovementComponent *Inertia =
+          Character->FindComponentByClass<UInertialMovementComponent>()) {
+    Inertia->SetComponentTickEnabled(false);
+
+    FEntry &Entry = Entries.AddDefaulted_GetRef();
+    Entry.Character = Character;
+    Entry.Inertia = Inertia;
+  }
+
+  // Rope late update: the mesh ticks after the CMC and, with parallel
+  // evaluation, only completes once the pose is out - hand socket is final
+  USkeletalMeshComponent *Mesh = Character->GetMesh();
+  if (Rope && Mesh) {
+    Rope->LateUpdateTick.AddPrerequisite(Mesh, Mesh->PrimaryComponentTick);
+  }
+
+  if (URopeRenderComponent *RopeRender =
+          Character->FindComponentByClass<URopeRenderComponent>()) {
+    RopeRender->SetTickGroup(TG_PostPhysics);
+    if (Rope) {
+      RopeRender->PrimaryComponentTick.AddPrerequisite(
+          Rope, Rope->PrimaryComponentTick);
+      RopeRender->PrimaryComponentTick.AddPrerequisite(Rope,
+                                                       Rope->LateUpdateTick);
+    }
+  }
+
+  // 5. Camera: after the pawn and its visuals have settled
+  if (URopeCameraManager *Camera =
+          Character->FindComponentByClass<URopeCameraManager>()) {
+    Camera->SetTickGroup(TG_PostPhysics);
+    Camera->PrimaryComponentTick.AddPrerequisite(this, PostMovementTick);
+
+    if (USpringArmComponent *SpringArm =
+            Character->FindComponentByClass<USpringArmComponent>()) {
+      SpringArm->PrimaryComponentTick.AddPrerequisite(
+          Camera, Camera->PrimaryComponentTick);
+    }
+  }
+}
+
+void UCharacterPipelineSubsystem::UnregisterCharacter(
+    ACharacterRope *Character) {
+  Entries.RemoveAllSwap(
+      [Character](const FEntry &Entry) {
+        return Entry.Character.Get() == Character;
+      },
+      EAllowShrinking::No);
+}
+
+// ===================================================================
+// PHASE 4: POST-MOVEMENT VISUALS
+// ===================================================================
+
+void UCharacterPipelineSubsystem::TickPostMovement(float DeltaTime) {
+  SCOPE_CYCLE_COUNTER(STAT_CharacterPostMovement);
+
+  // Who steps this frame (significance may slow a character's springs)
+  Steps.Reset();
+  bool bAnyDebug = false;
+
+  for (int32 i = Entries.Num() - 1; i >= 0; --i) {
+    FEntry &Entry = Entries[i];
+    ACharacterRope *Character = Entry.Character.Get();
+    UInertialMovementComponent *Inertia = Entry.Inertia.Get();
+    if (!Character || !Inertia) {
+      Entries.RemoveAtSwap(i, 1, EAllowShrinking::No);
+      continue;
+    }
+
+    Entry.PendingTime += DeltaTime;
+    if (Entry.PendingTime <
+        Character->GetSignificanceBudget().InertiaTickInterval) {
+      continue;
+    }
+
+    Steps.Add({Inertia, Entry.PendingTime});
+    Entry.PendingTime = 0.f;
+    bAnyDebug |= Inertia->IsShowingDebug();
+  }
+
+  // Springs: each component only writes itself. On-screen debug is not
+  // thread safe, so a debugged component keeps the batch on this thread.
+  const bool bSingleThread = bAnyDebug || Steps.Num() < MinParallelBatch;
+  ParallelFor(
+      Steps.Num(),
+      [this](int32 Index) {
+        Steps[Index].Inertia->TickSprings(Steps[Index].DeltaTime);
+      },
+      bSingleThread ? EParallelForFlags::ForceSingleThread
+                    : EParallelForFlags::None);
+
+  // Turn in place (moves actors), head look, replication
+  for (const FStep &Step : Steps) {
+    Step.Inertia->TickGameThread(Step.DeltaTime);
+  }
+}
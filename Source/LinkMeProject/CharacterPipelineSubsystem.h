@@ -0,0 +1,94 @@
+// CharacterPipelineSubsystem.h
+// Explicit per-character tick phases, with the visual springs batched
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineBaseTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CharacterPipelineSubsystem.generated.h"
+
+class ACharacterRope;
+class UCharacterPipelineSubsystem;
+class UInertialMovementComponent;
+
+/** Runs the post-movement phase of every registered character */
+USTRUCT()
+struct FCharacterPipelineTickFunction : public FTickFunction {
+  GENERATED_BODY()
+
+  UCharacterPipelineSubsystem *Pipeline = nullptr;
+
+  virtual void
+  ExecuteTick(float DeltaTime, ELevelTick TickType,
+              ENamedThreads::Type CurrentThread,
+              const FGraphEventRef &MyCompletionGraphEvent) override;
+  virtual FString DiagnosticMessage() override;
+};
+
+template <>
+struct TStructOpsTypeTraits<FCharacterPipelineTickFunction>
+    : public TStructOpsTypeTraitsBase2<FCharacterPipelineTickFunction> {
+  enum { WithCopy = false };
+};
+
+/**
+ * Per-character update order, declared once instead of left to whatever
+ * order the tick graph picks for ~7 independent tick functions.
+ *
+ * Phases, each a prerequisite of the next:
+ *  1. Input (pre-physics): actor Tick, then hook charge and aiming.
+ *  2. Rope gameplay: URopeSystemComponent (forces, wraps, swing replication).
+ *  3. Movement: the CharacterMovementComponent, fed by the rope forces.
+ *  4. Post-movement visuals (post-physics): inertia springs of all
+ *     characters in one batch (ParallelFor), then turn in place / head look
+ *     on the game thread. The rope's late update re-pins its player end to
+ *     the hand once the mesh has its final pose, then URopeRenderComponent
+ *     queues its step (URopeSimScheduler runs them at the end of the frame).
+ *  5. Camera: URopeCameraManager after the batch, then the spring arm.
+ *
+ * Inertia components stop ticking on their own once registered. The batch
+ * honours the character's significance budget (InertiaTickInterval).
+ */
+UCLASS()
+class LINKMEPROJECT_API UCharacterPipelineSubsystem : public UWorldSubsystem {
+  GENERATED_BODY()
+
+public:
+  virtual void OnWorldBeginPlay(UWorld &InWorld) override;
+  virtual void Deinitialize() override;
+
+  /** Wire the character's tick functions into the phases (BeginPlay) */
+  void RegisterCharacter(ACharacterRope *Character);
+  void UnregisterCharacter(ACharacterRope *Character);
+
+protected:
+  virtual bool DoesSupportWorldType(
+      const EWorldType::Type WorldType) const override;
+
+private:
+  friend struct FCharacterPipelineTickFunction;
+
+  /** Phase 4 */
+  void TickPostMovement(float DeltaTime);
+
+  struct FEntry {
+    TWeakObjectPtr<ACharacterRope> Character;
+    TWeakObjectPtr<UInertialMovementComponent> Inertia;
+
+    /** Time not yet simulated (significance tick interval) */
+    float PendingTime = 0.f;
+  };
+
+  struct FStep {
+    UInertialMovementComponent *Inertia = nullptr;
+    float DeltaTime = 0.f;
+  };
+
+  TArray<FEntry> Entries;
+
+  /** Scratch, reused every frame */
+  TArray<FStep> Steps;
+
+  FCharacterPipelineTickFunction PostMovementTick;
+};
@@ -1,13 +1,26 @@
 // CharacterRope.cpp
 
 #include "CharacterRope.h"
+#include "CharacterPipelineSubsystem.h"
 #include "Components/CapsuleComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "LinkMeProject.h"
+#include "LinkMeSignificanceManager.h"
 #include "Net/UnrealNetwork.h" // For DOREPLLIFETIME
+#include "UObject/ConstructorHelpers.h"
 
 #include "AimingComponent.h"
+#include "Components/HookTrajectoryPreviewComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Components/ViewQueryComponent.h"
+#include "EnhancedInputComponent.h"
+#include "InputAction.h"
+#include "RopeRenderComponent.h"
 #include "TPSAimingComponent.h"
 
+DECLARE_CYCLE_STAT(TEXT("Character Tick"), STAT_CharacterRopeTick,
+                   STATGROUP_LinkMe);
+
 ACharacterRope::ACharacterRope() {
   PrimaryActorTick.bCanEverTick = true;
 
@@ -15,10 +28,18 @@ ACharacterRope::ACharacterRope() {
   AimingComponent =
       CreateDefaultSubobject<UTPSAimingComponent>(TEXT("AimingComponent"));
 
+  // Create View Query Component (one camera trace per frame for all users)
+  ViewQueryComponent =
+      CreateDefaultSubobject<UViewQueryComponent>(TEXT("ViewQueryComponent"));
+
   // Create Hook Charge Component
   HookChargeComponent =
       CreateDefaultSubobject<UHookChargeComponent>(TEXT("HookChargeComponent"));
 
+  // Create Trajectory Preview (charge arc, drawn as a mesh)
+  TrajectoryPreview = CreateDefaultSubobject<UHookTrajectoryPreviewComponent>(
+      TEXT("TrajectoryPreview"));
+
   // Create Camera Manager Component
   CameraManager =
       CreateDefaultSubobject<URopeCameraManager>(TEXT("CameraManager"));
@@ -27,6 +48,13 @@ ACharacterRope::ACharacterRope() {
   InertialMovementComp = CreateDefaultSubobject<UInertialMovementComponent>(
       TEXT("InertialMovementComp"));
 
+  // Swing jump is bound natively so it is graded at the press time
+  static ConstructorHelpers::FObjectFinder<UInputAction> SwingJumpFinder(
+      TEXT("/Game/Input/Actions/IA_SwingJump.IA_SwingJump"));
+  if (SwingJumpFinder.Succeeded()) {
+    SwingJumpAction = SwingJumpFinder.Object;
+  }
+
   // Character orientation driven by movement (typical third-person setup).
   bUseControllerRotationYaw = false;
   bUseControllerRotationPitch = false;
@@ -56,6 +84,36 @@ void ACharacterRope::GetLifetimeReplicatedProps(
 void ACharacterRope::BeginPlay() {
   Super::BeginPlay();
 
+  bRunCosmetics = LinkMe::ShouldRunCosmetics(GetWorld());
+
+  // The server spawns the hook at the hand socket: the pose must stay live
+  const URopeSystemComponent *RopeSystem =
+      FindComponentByClass<URopeSystemComponent>();
+  const bool bGameplayReadsSockets =
+      RopeSystem && RopeSystem->HandSocketName != NAME_None;
+
+  if (!bRunCosmetics && GetMesh() && !bGameplayReadsSockets) {
+    // Nothing is rendered on a dedicated server: only montages (root motion,
+    // notifies) still need to advance
+    GetMesh()->VisibilityBasedAnimTickOption =
+        EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered;
+  }
+
+  // Explicit tick phases (input -> rope -> movement -> visuals -> camera)
+  if (UCharacterPipelineSubsystem *Pipeline =
+          GetWorld()->GetSubsystem<UCharacterPipelineSubsystem>()) {
+    Pipeline->RegisterCharacter(this);
+  }
+
+  if (bRunCosmetics) {
+    if (ULinkMeSignificanceManager *Significance =
+            ULinkMeSignificanceManager::Get(GetWorld())) {
+      // Anim update rate is driven per tier through the LOD frame-skip map
+      GetMesh()->bEnableUpdateRateOptimizations = true;
+      Significance->RegisterCharacter(this);
+    }
+  }
+
   // Configure TPS Aiming Component (magnetism settings)
   if (AimingComponent) {
     AimingComponent->bEnableMagnetism = bEnableMagnetism;
@@ -65,6 +123,62 @@ void ACharacterRope::BeginPlay() {
   }
 }
 
+void ACharacterRope::EndPlay(const EEndPlayReason::Type EndPlayReason) {
+  if (UCharacterPipelineSubsystem *Pipeline =
+          GetWorld()->GetSubsystem<UCharacterPipelineSubsystem>()) {
+    Pipeline->UnregisterCharacter(this);
+  }
+  if (ULinkMeSignificanceManager *Significance =
+          ULinkMeSignificanceManager::Get(GetWorld())) {
+    Significance->UnregisterCharacter(this);
+  }
+
+  Super::EndPlay(EndPlayReason);
+}
+
+// ============================================================================
+// SIGNIFICANCE
+// ============================================================================
+
+void ACharacterRope::ApplySignificanceBudget(
+    EMonkeySignificance Tier, const FMonkeySignificanceBudget &Budget) {
+  SignificanceTier = Tier;
+  SignificanceBudget = Budget;
+
+  // Animation: evaluate every AnimUpdateRate frames whatever the mesh LOD,
+  // interpolating the skipped ones
+  if (FAnimUpdateRateParameters *RateParams =
+          GetMesh() ? GetMesh()->AnimUpdateRateParams : nullptr) {
+    RateParams->bShouldUseLodMap = true;
+    RateParams->LODToFrameSkipMap.Reset();
+    for (int32 LOD = 0; LOD < MAX_SKELETAL_MESH_LODS; ++LOD) {
+      RateParams->LODToFrameSkipMap.Add(LOD, Budget.AnimUpdateRate - 1);
+    }
+    RateParams->MaxEvalRateForInterpolation =
+        FMath::Max(RateParams->MaxEvalRateForInterpolation,
+                   Budget.AnimUpdateRate);
+    RateParams->BaseNonRenderedUpdateRate =
+        FMath::Max(Budget.AnimUpdateRate, 1);
+  }
+
+  // Inertia springs: UCharacterPipelineSubsystem reads InertiaTickInterval
+
+  // Limb IK reads bLimbIK / IKProbeInterval in UpdateLimbIK
+
+  // Rope visual
+  if (URopeRenderComponent *RopeRender =
+          FindComponentByClass<URopeRenderComponent>()) {
+    RopeRender->SetSimulationLOD(Budget.RopeSimLOD);
+    RopeRender->SetComponentTickInterval(Budget.RopeTickInterval);
+  }
+
+  // The camera rig of a character nobody looks through does nothing useful
+  if (CameraManager) {
+    CameraManager->SetComponentTickEnabled(Tier ==
+                                           EMonkeySignificance::Local);
+  }
+}
+
 void ACharacterRope::Landed(const FHitResult &Hit) {
   Super::Landed(Hit);
 
@@ -86,6 +200,7 @@ void ACharacterRope::Landed(const FHitResult &Hit) {
 
 void ACharacterRope::Tick(float DeltaTime) {
   Super::Tick(DeltaTime);
+  SCOPE_CYCLE_COUNTER(STAT_CharacterRopeTick);
 
   // Update Locomotion (Client & Server run this for prediction)
   // Update Speed (Interpolate MaxWalkSpeed)
@@ -111,7 +226,11 @@ void ACharacterRope::Tick(float DeltaTime) {
   // if (bShowDebug) {
   //   DrawDebugHelpers(DeltaTime);
   // }
-  // Update Procedural Animation (IK, Lean, Swing, Landing)
+  // Cosmetic only from here on (procedural data, trajectory, reticle)
+  if (!bRunCosmetics)
+    return;
+
+  // Update Procedural Animation (Lean, Swing, Landing)
   UpdateProceduralAnimation(DeltaTime);
 
   // NOTE: Camera logic is now handled by PlayerCameraManager
@@ -135,6 +254,9 @@ void ACharacterRope::Tick(float DeltaTime) {
     if (FocusReticleInstance && !FocusReticleInstance->IsHidden()) {
       FocusReticleInstance->SetActorHiddenInGame(true);
     }
+    if (TrajectoryPreview) {
+      TrajectoryPreview->HideArc();
+    }
   }
 
   // Legacy Trajectory (Fallback if not charging but aiming?
@@ -232,6 +354,10 @@ void ACharacterRope::CancelHookCharge() {
   if (FocusReticleInstance) {
     FocusReticleInstance->SetActorHiddenInGame(true);
   }
+
+  if (TrajectoryPreview) {
+    TrajectoryPreview->HideArc();
+  }
 }
 
 void ACharacterRope::FireChargedHook() {
@@ -350,19 +476,6 @@ void ACharacterRope::UpdateTrajectoryVisualization(float DeltaTime) {
 
   FVector StartLoc = GetProjectileStartLocation();
 
-  // Configurer prédiction
-  FPredictProjectilePathParams PredictParams;
-  PredictParams.StartLocation = StartLoc;
-  PredictParams.LaunchVelocity = LaunchVelocity;
-  PredictParams.bTraceWithCollision = true;
-  PredictParams.bTraceComplex = false;
-  PredictParams.ProjectileRadius = 5.0f;
-  PredictParams.MaxSimTime = 3.0f;
-  PredictParams.SimFrequency = 15.0f;
-  PredictParams.TraceChannel =
-      ECC_WorldStatic; // Should use HookChargeComponent->ProjectileTraceChannel
-  PredictParams.ActorsToIgnore.Add(this);
-
   // Couleur selon état
   FLinearColor TraceColor = TrajectoryColorNormal;
 
@@ -377,28 +490,12 @@ void ACharacterRope::UpdateTrajectoryVisualization(float DeltaTime) {
     }
   }
 
-  // Disable built-in debug drawing to handle color manually
-  PredictParams.DrawDebugType = EDrawDebugTrace::None;
-
-  FPredictProjectilePathResult PredictResult;
-  if (UGameplayStatics::PredictProjectilePath(GetWorld(), PredictParams,
-                                              PredictResult)) {
-    // Draw trajectory manually
-    for (int32 i = 0; i < PredictResult.PathData.Num() - 1; ++i) {
-      DrawDebugLine(GetWorld(), PredictResult.PathData[i].Location,
-                    PredictResult.PathData[i + 1].Location,
-                    TraceColor.ToFColor(true), false,
-                    TrajectoryUpdateFrequency + 0.02f, 0,
-                    3.0f // Thickness
-      );
-    }
-
-    // Draw Impact point if hit
-    if (PredictResult.HitResult.bBlockingHit) {
-      DrawDebugSphere(GetWorld(), PredictResult.HitResult.ImpactPoint, 10.0f,
-                      12, TraceColor.ToFColor(true), false,
-                      TrajectoryUpdateFrequency + 0.02f);
-    }
+  // Same collision setup as the hook itself
+  if (TrajectoryPreview) {
+    TrajectoryPreview->ProjectileRadius = HookChargeComponent->ProjectileRadius;
+    TrajectoryPreview->TraceChannel =
+        HookChargeComponent->ProjectileTraceChannel;
+    TrajectoryPreview->ShowArc(StartLoc, LaunchVelocity, TraceColor);
   }
 }
 
@@ -458,6 +555,25 @@ void ACharacterRope::SetupPlayerInputComponent(
                                    &ACharacterRope::StartWalking);
   PlayerInputComponent->BindAction("Walk", IE_Released, this,
                                    &ACharacterRope::StopWalking);
+
+  // Rope Bindings
+  UEnhancedInputComponent *EnhancedInput =
+      Cast<UEnhancedInputComponent>(PlayerInputComponent);
+  if (EnhancedInput && SwingJumpAction) {
+    EnhancedInput->BindAction(SwingJumpAction, ETriggerEvent::Started, this,
+                              &ACharacterRope::OnSwingJumpInput);
+  }
+}
+
+void ACharacterRope::OnSwingJumpInput() {
+  URopeSystemComponent *RopeSystem =
+      FindComponentByClass<URopeSystemComponent>();
+  if (!RopeSystem)
+    return;
+
+  // Taken in the handler, before anything else this frame can shift it
+  const double InputTime = RopeSystem->GetInputTimeSeconds();
+  RopeSystem->SwingJumpAtTime(SwingJumpBoost, InputTime);
 }
 
 // ============================================================================
@@ -712,14 +828,45 @@ void ACharacterRope::UpdateLocomotionSpeed(float DeltaTime) {
 // ============================================================================
 
 void ACharacterRope::UpdateProceduralAnimation(float DeltaTime) {
-  // ----- IK OFFSET CALCULATION -----
+  // ----- IK -----
+  UpdateLimbIK();
+
+  // ----- INERTIAL BANKING & ACCELERATION TILT -----
+  if (InertialMovementComp) {
+    const FBodyInertiaState &State = InertialMovementComp->GetBodyInertia();
+    ProceduralData.LeanAmount.Roll = State.LeanRoll;
+    ProceduralData.LeanAmount.Pitch = State.LeanPitch;
+    ProceduralData.LeanAmount.Yaw =
+        State.TorsoTwistYaw; // Using TorsoTwist for LookAt logic if needed
+  }
+
+  // ----- SWING PHASE (TODO: Integrate with RopeSystem) -----
+  // ProceduralData.SwingPhase = ...;
+  // ProceduralData.SwingIntensity = ...;
+
+  // ----- LANDING ALPHA (TODO: Integrate with CMC) -----
+  // Decay landing alpha
+  ProceduralData.LandingAlpha =
+      FMath::FInterpTo(ProceduralData.LandingAlpha, 0.0f, DeltaTime, 5.0f);
+}
+
+void ACharacterRope::UpdateLimbIK() {
   // Disable IK when falling/jumping to prevent feet stretching to ground
   const bool bIsInAir =
       GetCharacterMovement() && GetCharacterMovement()->IsFalling();
 
-  if (bEnableIK && !bIsInAir) {
+  // The significance budget may turn limb IK off for far characters
+  const bool bBudgetIK = GetSignificanceBudget().bLimbIK;
+
+  // Between probes the AnimBP keeps blending towards the last offsets
+  const float Now = GetWorld()->GetTimeSeconds();
+  const bool bProbeDue = Now >= NextIKProbeTime;
+
+  if (bEnableIK && !bIsInAir && bBudgetIK) {
     USkeletalMeshComponent *MeshComp = GetMesh();
-    if (MeshComp) {
+    if (MeshComp && bProbeDue) {
+      NextIKProbeTime = Now + GetSignificanceBudget().IKProbeInterval;
+
       // Expected floor Z (bottom of capsule)
       const float ExpectedFloorZ =
           GetActorLocation().Z -
@@ -787,30 +934,12 @@ void ACharacterRope::UpdateProceduralAnimation(float DeltaTime) {
           FMath::Min(ProceduralData.Foot_L.EffectorOffset.Z,
                      ProceduralData.Foot_R.EffectorOffset.Z);
     }
-  } else if (bIsInAir) {
-    // Reset IK when in air
+  } else if (bIsInAir || !bBudgetIK) {
+    // Reset IK when in air (or out of budget)
     ProceduralData.Foot_L.Alpha = 0.0f;
     ProceduralData.Foot_R.Alpha = 0.0f;
     ProceduralData.Hand_L.Alpha = 0.0f;
     ProceduralData.Hand_R.Alpha = 0.0f;
     ProceduralData.PelvisOffset = 0.0f;
   }
-
-  // ----- INERTIAL BANKING & ACCELERATION TILT -----
-  if (InertialMovementComp) {
-    const FBodyInertiaState &State = InertialMovementComp->GetBodyInertia();
-    ProceduralData.LeanAmount.Roll = State.LeanRoll;
-    ProceduralData.LeanAmount.Pitch = State.LeanPitch;
-    ProceduralData.LeanAmount.Yaw =
-        State.TorsoTwistYaw; // Using TorsoTwist for LookAt logic if needed
-  }
-
-  // ----- SWING PHASE (TODO: Integrate with RopeSystem) -----
-  // ProceduralData.SwingPhase = ...;
-  // ProceduralData.SwingIntensity = ...;
-
-  // ----- LANDING ALPHA (TODO: Integrate with CMC) -----
-  // Decay landing alpha
-  ProceduralData.LandingAlpha =
-      FMath::FInterpTo(ProceduralData.LandingAlpha, 0.0f, DeltaTime, 5.0f);
 }
@@ -50,6 +50,10 @@ protected:
   UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Aiming")
   class UTPSAimingComponent *AimingComponent;
 
+  /** Shared per-frame camera ray (aim, magnetism, head look, trajectory) */
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Aiming")
+  class UViewQueryComponent *ViewQueryComponent;
+
   // ===================================================================
   // MAGNETISM CONFIGURATION (for TPSAimingComponent)
   // ===================================================================
@@ -101,6 +105,11 @@ protected:
   UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Hook Charge")
   UHookChargeComponent *HookChargeComponent;
 
+  /** Charge arc preview (incremental sweeps, procedural mesh) */
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly,
+            Category = "Hook Charge|Visualization")
+  class UHookTrajectoryPreviewComponent *TrajectoryPreview;
+
   UFUNCTION(BlueprintCallable, Category = "Hook Charge")
   void StartChargingHook();
 
@@ -146,10 +155,37 @@ protected:
 
   float TimeSinceLastTrajectoryUpdate = 0.0f;
 
+  /** False on a dedicated server: procedural IK and charge visuals skipped */
+  bool bRunCosmetics = true;
+
 protected:
   virtual void BeginPlay() override;
+  virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
   virtual void Landed(const FHitResult &Hit) override;
 
+  // ===================================================================
+  // SIGNIFICANCE
+  // ===================================================================
+
+public:
+  /**
+   * Throttle the cosmetic systems to a tier's budget. Called by
+   * ULinkMeSignificanceManager when the character changes tier.
+   */
+  void ApplySignificanceBudget(EMonkeySignificance Tier,
+                               const FMonkeySignificanceBudget &Budget);
+
+  EMonkeySignificance GetSignificanceTier() const { return SignificanceTier; }
+
+  /** Full rate until the significance manager says otherwise */
+  const FMonkeySignificanceBudget &GetSignificanceBudget() const {
+    return SignificanceBudget;
+  }
+
+private:
+  EMonkeySignificance SignificanceTier = EMonkeySignificance::Local;
+  FMonkeySignificanceBudget SignificanceBudget;
+
   // ===================================================================
   // LOCOMOTION & STANCE SYSTEM
   // ===================================================================
@@ -234,7 +270,7 @@ public:
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Procedural|IK")
   float IK_FootOffset = 5.0f;
 
-  /** Enable IK (for debugging) */
+  /** Enable limb IK (for debugging) */
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Procedural|IK")
   bool bEnableIK = true;
 
@@ -246,6 +282,13 @@ protected:
   /** Update all procedural animation data (IK, Lean, Swing, Landing) */
   void UpdateProceduralAnimation(float DeltaTime);
 
+  /** Foot / hand ground traces into the IK fields of ProceduralData, at
+   * most once per IKProbeInterval of the significance budget */
+  void UpdateLimbIK();
+
+  /** World time of the next limb IK probe */
+  float NextIKProbeTime = 0.f;
+
 public:
   // --- ACTIONS ---
 
@@ -277,7 +320,21 @@ public:
   UFUNCTION(BlueprintPure, Category = "Locomotion")
   EMonkeyGait GetGait() const { return CurrentGait; }
 
+  // --- ROPE INPUT ---
+
+  /** Bound in SetupPlayerInputComponent: the jump is graded at the press
+   * time. Defaults to IA_SwingJump. */
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
+  class UInputAction *SwingJumpAction = nullptr;
+
+  /** Base boost of a swing jump (URopeSystemComponent::SwingJumpAtTime) */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input")
+  float SwingJumpBoost = 1.2f;
+
 protected:
+  /** SwingJumpAction pressed */
+  void OnSwingJumpInput();
+
   // --- REPLICATION & INTERNAL ---
 
   UFUNCTION()
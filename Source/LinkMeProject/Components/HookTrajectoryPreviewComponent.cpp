@@ -0,0 +1,278 @@
+#include "Components/HookTrajectoryPreviewComponent.h"
+#include "../LinkMeProject.h"
+#include "DrawDebugHelpers.h"
+#include "Engine/World.h"
+#include "Materials/MaterialInterface.h"
+#include "ProceduralMeshComponent.h"
+#include "UObject/ConstructorHelpers.h"
+
+DECLARE_CYCLE_STAT(TEXT("Trajectory Preview"), STAT_TrajectoryPreview,
+                   STATGROUP_LinkMe);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Trajectory Sweeps"), STAT_TrajectorySweeps,
+                           STATGROUP_LinkMe);
+
+UHookTrajectoryPreviewComponent::UHookTrajectoryPreviewComponent() {
+  PrimaryComponentTick.bCanEverTick = true;
+  PrimaryComponentTick.bStartWithTickEnabled = false;
+
+  // Engine's unlit vertex colour material, so the per-vertex arc state shows
+  // without a project material (override per character if needed)
+  static ConstructorHelpers::FObjectFinder<UMaterialInterface> VertexColor(
+      TEXT("/Engine/EngineDebugMaterials/"
+           "VertexColorMaterial.VertexColorMaterial"));
+  if (VertexColor.Succeeded()) {
+    TrajectoryMaterial = VertexColor.Object;
+  }
+}
+
+void UHookTrajectoryPreviewComponent::BeginPlay() {
+  Super::BeginPlay();
+
+  // Purely visual: nothing to do on a dedicated server
+  bRunCosmetics = LinkMe::ShouldRunCosmetics(GetWorld());
+  if (!bRunCosmetics)
+    return;
+
+  AActor *Owner = GetOwner();
+  if (!Owner)
+    return;
+
+  QueryParams = FCollisionQueryParams(SCENE_QUERY_STAT(TrajectoryPreview),
+                                      false, Owner);
+
+  // Vertices are written in world space: the mesh sits at the origin
+  TrajectoryMesh =
+      NewObject<UProceduralMeshComponent>(Owner, TEXT("TrajectoryMesh"));
+  if (TrajectoryMesh) {
+    TrajectoryMesh->SetupAttachment(Owner->GetRootComponent());
+    TrajectoryMesh->SetUsingAbsoluteLocation(true);
+    TrajectoryMesh->SetUsingAbsoluteRotation(true);
+    TrajectoryMesh->SetUsingAbsoluteScale(true);
+    TrajectoryMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    TrajectoryMesh->SetCastShadow(false);
+    TrajectoryMesh->SetVisibility(false);
+    TrajectoryMesh->RegisterComponent();
+    TrajectoryMesh->SetWorldTransform(FTransform::Identity);
+  }
+}
+
+void UHookTrajectoryPreviewComponent::EndPlay(
+    const EEndPlayReason::Type EndPlayReason) {
+  if (TrajectoryMesh) {
+    TrajectoryMesh->DestroyComponent();
+    TrajectoryMesh = nullptr;
+  }
+
+  Super::EndPlay(EndPlayReason);
+}
+
+int32 UHookTrajectoryPreviewComponent::GetNumSegments() const {
+  return FMath::Clamp(FMath::CeilToInt(MaxSimTime * SimFrequency), 1, 128);
+}
+
+// ===================================================================
+// PUBLIC API
+// ===================================================================
+
+void UHookTrajectoryPreviewComponent::ShowArc(const FVector &Start,
+                                              const FVector &LaunchVelocity,
+                                              FLinearColor Color) {
+  if (!bRunCosmetics || !TrajectoryMesh)
+    return;
+
+  const int32 NumSegments = GetNumSegments();
+  if (Segments.Num() != NumSegments) {
+    Segments.Reset();
+    Segments.SetNum(NumSegments);
+  }
+  ArcPoints.SetNum(NumSegments + 1, EAllowShrinking::No);
+  ArcTangents.SetNum(NumSegments + 1, EAllowShrinking::No);
+
+  // p(t) = p0 + v t + g t^2 / 2, tangent v + g t
+  const FVector Gravity(0.0, 0.0, GetWorld()->GetGravityZ());
+  const double Dt = MaxSimTime / NumSegments;
+  for (int32 i = 0; i <= NumSegments; ++i) {
+    const double T = Dt * i;
+    ArcPoints[i] = Start + LaunchVelocity * T + Gravity * (0.5 * T * T);
+    ArcTangents[i] =
+        (LaunchVelocity + Gravity * T).GetSafeNormal(KINDA_SMALL_NUMBER,
+                                                     FVector::ForwardVector);
+  }
+
+  // Keep the sweeps of segments that barely moved
+  for (int32 i = 0; i < NumSegments; ++i) {
+    FArcSegment &Segment = Segments[i];
+    if (!Segment.bSwept ||
+        !Segment.SweptStart.Equals(ArcPoints[i], ReuseTolerance) ||
+        !Segment.SweptEnd.Equals(ArcPoints[i + 1], ReuseTolerance)) {
+      Segment.bSwept = false;
+    }
+  }
+
+  ArcColor = Color.ToFColor(true);
+  bMeshDirty = true;
+
+  if (!bArcVisible) {
+    bArcVisible = true;
+    TrajectoryMesh->SetVisibility(true);
+    SetComponentTickEnabled(true);
+  }
+}
+
+void UHookTrajectoryPreviewComponent::HideArc() {
+  if (!bArcVisible)
+    return;
+
+  bArcVisible = false;
+  if (TrajectoryMesh) {
+    TrajectoryMesh->SetVisibility(false);
+  }
+  SetComponentTickEnabled(false);
+}
+
+bool UHookTrajectoryPreviewComponent::GetPredictedImpact(
+    FVector &OutLocation) const {
+  for (const FArcSegment &Segment : Segments) {
+    if (!Segment.bSwept)
+      return false;
+    if (Segment.bBlocked) {
+      OutLocation = Segment.HitLocation;
+      return true;
+    }
+  }
+  return false;
+}
+
+// ===================================================================
+// UPDATE
+// ===================================================================
+
+void UHookTrajectoryPreviewComponent::TickComponent(
+    float DeltaTime, ELevelTick TickType,
+    FActorComponentTickFunction *ThisTickFunction) {
+  Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+  SCOPE_CYCLE_COUNTER(STAT_TrajectoryPreview);
+
+  if (!bArcVisible)
+    return;
+
+  SweepDirtySegments();
+
+  if (bMeshDirty) {
+    RebuildMesh();
+    bMeshDirty = false;
+  }
+}
+
+void UHookTrajectoryPreviewComponent::SweepDirtySegments() {
+  const FCollisionShape Sphere = FCollisionShape::MakeSphere(ProjectileRadius);
+  int32 Budget = MaxSweepsPerFrame;
+
+  for (int32 i = 0; i < Segments.Num(); ++i) {
+    FArcSegment &Segment = Segments[i];
+
+    if (!Segment.bSwept) {
+      if (Budget <= 0)
+        break;
+      --Budget;
+
+      FHitResult Hit;
+      Segment.bBlocked = GetWorld()->SweepSingleByChannel(
+          Hit, ArcPoints[i], ArcPoints[i + 1], FQuat::Identity, TraceChannel,
+          Sphere, QueryParams);
+      Segment.HitLocation = Segment.bBlocked ? Hit.Location : ArcPoints[i + 1];
+      Segment.SweptStart = ArcPoints[i];
+      Segment.SweptEnd = ArcPoints[i + 1];
+      Segment.bSwept = true;
+      bMeshDirty = true;
+      INC_DWORD_STAT(STAT_TrajectorySweeps);
+    }
+
+    // Nothing past the first obstacle is visible
+    if (Segment.bBlocked)
+      break;
+  }
+}
+
+void UHookTrajectoryPreviewComponent::CreateMeshSection(int32 NumSegments) {
+  const int32 Sides = TubeSides;
+  const int32 NumRings = NumSegments + 1;
+  const int32 NumVertices = NumRings * Sides;
+
+  Vertices.SetNumZeroed(NumVertices);
+  Normals.SetNumZeroed(NumVertices);
+  Colors.SetNumZeroed(NumVertices);
+
+  TArray<int32> Triangles;
+  Triangles.Reserve(NumSegments * Sides * 6);
+  for (int32 Ring = 0; Ring < NumSegments; ++Ring) {
+    for (int32 Side = 0; Side < Sides; ++Side) {
+      const int32 A = Ring * Sides + Side;
+      const int32 B = Ring * Sides + (Side + 1) % Sides;
+      const int32 C = A + Sides;
+      const int32 D = B + Sides;
+      Triangles.Append({A, C, B, B, C, D});
+    }
+  }
+
+  TrajectoryMesh->CreateMeshSection(0, Vertices, Triangles, Normals,
+                                    TArray<FVector2D>(), Colors,
+                                    TArray<FProcMeshTangent>(), false);
+  if (TrajectoryMaterial) {
+    TrajectoryMesh->SetMaterial(0, TrajectoryMaterial);
+  }
+  SectionSegments = NumSegments;
+}
+
+void UHookTrajectoryPreviewComponent::RebuildMesh() {
+  if (!TrajectoryMesh || Segments.Num() == 0)
+    return;
+
+  const int32 NumSegments = Segments.Num();
+  if (SectionSegments != NumSegments ||
+      Vertices.Num() != (NumSegments + 1) * TubeSides) {
+    CreateMeshSection(NumSegments);
+  }
+
+  // Visible rings: up to the first known obstacle (later segments may still
+  // be unswept this frame; they are drawn until proven blocked)
+  int32 LastRing = NumSegments;
+  FVector EndPoint = ArcPoints[NumSegments];
+  bool bHasImpact = false;
+  for (int32 i = 0; i < NumSegments; ++i) {
+    if (Segments[i].bSwept && Segments[i].bBlocked) {
+      LastRing = i + 1;
+      EndPoint = Segments[i].HitLocation;
+      bHasImpact = true;
+      break;
+    }
+  }
+
+  const int32 Sides = TubeSides;
+  for (int32 Ring = 0; Ring <= NumSegments; ++Ring) {
+    // Unused rings collapse onto the end point (degenerate, invisible)
+    const int32 SourceRing = FMath::Min(Ring, LastRing);
+    const FVector Center =
+        (SourceRing == LastRing) ? EndPoint : ArcPoints[SourceRing];
+    const FMatrix Basis = FRotationMatrix::MakeFromX(ArcTangents[SourceRing]);
+    const FVector AxisY = Basis.GetScaledAxis(EAxis::Y);
+    const FVector AxisZ = Basis.GetScaledAxis(EAxis::Z);
+
+    for (int32 Side = 0; Side < Sides; ++Side) {
+      const float Angle = (2.f * PI * Side) / Sides;
+      const FVector Normal =
+          AxisY * FMath::Cos(Angle) + AxisZ * FMath::Sin(Angle);
+      const int32 Index = Ring * Sides + Side;
+      Vertices[Index] = Center + Normal * TubeRadius;
+      Normals[Index] = Normal;
+      Colors[Index] = ArcColor;
+    }
+  }
+
+  TrajectoryMesh->UpdateMeshSection(0, Vertices, Normals, TArray<FVector2D>(),
+                                    Colors, TArray<FProcMeshTangent>());
+
+  if (bShowDebug && bHasImpact) {
+    DrawDebugSphere(GetWorld(), EndPoint, 10.f, 12, ArcColor, false, -1.f);
+  }
+}
@@ -0,0 +1,132 @@
+#pragma once
+
+#include "Components/ActorComponent.h"
+#include "CoreMinimal.h"
+#include "HookTrajectoryPreviewComponent.generated.h"
+
+class UMaterialInterface;
+class UProceduralMeshComponent;
+
+/**
+ * Hook charge trajectory preview.
+ *
+ * The arc is analytic (constant gravity, no drag) and sampled at fixed time
+ * steps. Each segment remembers its last sweep: when the start or velocity
+ * changes, only segments whose endpoints moved more than ReuseTolerance are
+ * swept again, at most MaxSweepsPerFrame per tick, and nothing past the
+ * first blocking hit. The arc is drawn as a tube in a single procedural mesh
+ * section allocated once and rewritten in place, so unlike DrawDebugLine it
+ * also shows in shipping builds.
+ */
+UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
+class LINKMEPROJECT_API UHookTrajectoryPreviewComponent
+    : public UActorComponent {
+  GENERATED_BODY()
+
+public:
+  UHookTrajectoryPreviewComponent();
+
+  virtual void BeginPlay() override;
+  virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+  virtual void
+  TickComponent(float DeltaTime, ELevelTick TickType,
+                FActorComponentTickFunction *ThisTickFunction) override;
+
+  /** Show (or move) the arc. Cheap: call it every frame while charging. */
+  UFUNCTION(BlueprintCallable, Category = "Trajectory")
+  void ShowArc(const FVector &Start, const FVector &LaunchVelocity,
+               FLinearColor Color);
+
+  UFUNCTION(BlueprintCallable, Category = "Trajectory")
+  void HideArc();
+
+  UFUNCTION(BlueprintPure, Category = "Trajectory")
+  bool IsArcVisible() const { return bArcVisible; }
+
+  /** Blocking hit that ends the arc, once the sweeps have reached it */
+  UFUNCTION(BlueprintPure, Category = "Trajectory")
+  bool GetPredictedImpact(FVector &OutLocation) const;
+
+  // ===================================================================
+  // CONFIGURATION
+  // ===================================================================
+
+  /** Length of the previewed flight (s) */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trajectory",
+            meta = (ClampMin = "0.1"))
+  float MaxSimTime = 3.0f;
+
+  /** Arc samples per second of flight (one sweep per sample) */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trajectory",
+            meta = (ClampMin = "1"))
+  float SimFrequency = 15.0f;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trajectory")
+  float ProjectileRadius = 5.0f;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trajectory")
+  TEnumAsByte<ECollisionChannel> TraceChannel = ECC_WorldStatic;
+
+  /** A segment whose endpoints moved less than this keeps its sweep (cm) */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite,
+            Category = "Trajectory|Performance", meta = (ClampMin = "0"))
+  float ReuseTolerance = 2.0f;
+
+  /** Sweep budget per tick; the arc converges over a few frames at worst */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite,
+            Category = "Trajectory|Performance", meta = (ClampMin = "1"))
+  int32 MaxSweepsPerFrame = 8;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trajectory|Visuals")
+  float TubeRadius = 1.5f;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trajectory|Visuals",
+            meta = (ClampMin = "3", ClampMax = "16"))
+  int32 TubeSides = 6;
+
+  /** Unlit material reading vertex color (the arc color is per vertex).
+   * Defaults to the engine's VertexColorMaterial. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trajectory|Visuals")
+  UMaterialInterface *TrajectoryMaterial = nullptr;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Debug")
+  bool bShowDebug = false;
+
+private:
+  struct FArcSegment {
+    /** Endpoints the cached sweep was done with */
+    FVector SweptStart = FVector::ZeroVector;
+    FVector SweptEnd = FVector::ZeroVector;
+    FVector HitLocation = FVector::ZeroVector;
+    bool bSwept = false;
+    bool bBlocked = false;
+  };
+
+  int32 GetNumSegments() const;
+  void SweepDirtySegments();
+  void RebuildMesh();
+  void CreateMeshSection(int32 NumSegments);
+
+  UPROPERTY(Transient)
+  TObjectPtr<UProceduralMeshComponent> TrajectoryMesh;
+
+  /** Current analytic samples [Start, P1 .. PN] and their tangents */
+  TArray<FVector> ArcPoints;
+  TArray<FVector> ArcTangents;
+  TArray<FArcSegment> Segments;
+
+  FColor ArcColor = FColor::Yellow;
+  bool bArcVisible = false;
+  bool bMeshDirty = false;
+
+  /** Segment count the mesh section was created for (INDEX_NONE: none) */
+  int32 SectionSegments = INDEX_NONE;
+
+  // Reused mesh buffers (vertex count is fixed per section)
+  TArray<FVector> Vertices;
+  TArray<FVector> Normals;
+  TArray<FColor> Colors;
+
+  FCollisionQueryParams QueryParams;
+  bool bRunCosmetics = true;
+};
@@ -1,11 +1,55 @@
 #include "Components/InertialMovementComponent.h"
+#include "../AimingComponent.h"
 #include "../CharacterRope.h"
+#include "../LinkMeProject.h"
+#include "Components/ViewQueryComponent.h"
 #include "DrawDebugHelpers.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Kismet/KismetMathLibrary.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "Net/UnrealNetwork.h"
 
+DECLARE_CYCLE_STAT(TEXT("Inertia Tick"), STAT_InertiaTick, STATGROUP_LinkMe);
+
+namespace {
+
+// Angle in [-Range, Range] <-> NumBits unsigned
+void SerializeAngle(FArchive &Ar, float &Angle, float Range, uint32 NumBits) {
+  const uint32 MaxValue = (1u << NumBits) - 1;
+  uint32 Quantized = 0;
+  if (Ar.IsSaving()) {
+    const float Alpha =
+        (FMath::Clamp(Angle, -Range, Range) + Range) / (2.f * Range);
+    Quantized = uint32(FMath::RoundToInt(Alpha * MaxValue));
+  }
+  Ar.SerializeInt(Quantized, MaxValue + 1);
+  if (Ar.IsLoading()) {
+    Angle = float(Quantized) / MaxValue * 2.f * Range - Range;
+  }
+}
+
+} // namespace
+
+bool FInertiaNetPose::NetSerialize(FArchive &Ar, UPackageMap *Map,
+                                   bool &bOutSuccess) {
+  // Leans are clamped to +-45 by the springs
+  SerializeAngle(Ar, LeanRoll, 45.f, 8);
+  SerializeAngle(Ar, LeanPitch, 45.f, 8);
+  SerializeAngle(Ar, TorsoTwistYaw, 180.f, 10);
+
+  if (Ar.IsSaving()) {
+    HeadLookAtRotation.Normalize();
+  }
+  SerializeAngle(Ar, HeadLookAtRotation.Pitch, 180.f, 10);
+  SerializeAngle(Ar, HeadLookAtRotation.Yaw, 180.f, 10);
+  // Roll only carries the constant bone offset
+  SerializeAngle(Ar, HeadLookAtRotation.Roll, 180.f, 8);
+
+  bOutSuccess = true;
+  return true;
+}
+
 UInertialMovementComponent::UInertialMovementComponent() {
   PrimaryComponentTick.bCanEverTick = true;
   SetIsReplicatedByDefault(true);
@@ -26,8 +70,20 @@ UInertialMovementComponent::GetCurrentLimits(bool bIsQuadruped) const {
 void UInertialMovementComponent::GetLifetimeReplicatedProps(
     TArray<FLifetimeProperty> &OutLifetimeProps) const {
   Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-  DOREPLIFETIME(UInertialMovementComponent, CurrentBodyInertia);
-  DOREPLIFETIME(UInertialMovementComponent, CurrentHeadLook);
+
+  // The owner computes its own pose
+  FDoRepLifetimeParams Params;
+  Params.bIsPushBased = true;
+  Params.Condition = COND_SkipOwner;
+  DOREPLIFETIME_WITH_PARAMS_FAST(UInertialMovementComponent, NetPose, Params);
+}
+
+void UInertialMovementComponent::PreReplication(
+    IRepChangedPropertyTracker &ChangedPropertyTracker) {
+  Super::PreReplication(ChangedPropertyTracker);
+  DOREPLIFETIME_ACTIVE_OVERRIDE_FAST(
+      UInertialMovementComponent, NetPose,
+      ReplicationMode == EInertiaReplicationMode::Quantized);
 }
 
 void UInertialMovementComponent::BeginPlay() {
@@ -36,6 +92,15 @@ void UInertialMovementComponent::BeginPlay() {
   OwnerCharacter = Cast<ACharacter>(GetOwner());
   if (OwnerCharacter) {
     MovementComp = OwnerCharacter->GetCharacterMovement();
+
+    ViewQuery = OwnerCharacter->FindComponentByClass<UViewQueryComponent>();
+    AimingComp = OwnerCharacter->FindComponentByClass<UAimingComponent>();
+    if (ViewQuery) {
+      HeadLookQuery =
+          ViewQuery->AddQuery(ECC_Visibility, 0.f, HeadLookAtDistance * 10.f);
+      SyncHeadLookQuery();
+    }
+
     PreviousVelocity = OwnerCharacter->GetVelocity();
     PreviousYaw = OwnerCharacter->GetActorRotation().Yaw;
     MeshYaw = PreviousYaw; // Initialize mesh yaw to match capsule
@@ -46,21 +111,42 @@ void UInertialMovementComponent::TickComponent(
     float DeltaTime, ELevelTick TickType,
     FActorComponentTickFunction *ThisTickFunction) {
   Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+  SCOPE_CYCLE_COUNTER(STAT_InertiaTick);
+
+  // Standalone path; ACharacterRope batches these through
+  // UCharacterPipelineSubsystem instead
+  TickSprings(DeltaTime);
+  TickGameThread(DeltaTime);
+}
 
-  // Authority check: Only calculate on owning client or server authority
-  // Non-owning clients use replicated values from FInertiaState
-  if (OwnerCharacter && !OwnerCharacter->IsLocallyControlled() &&
-      !OwnerCharacter->HasAuthority()) {
+bool UInertialMovementComponent::IsRemotePose() const {
+  // Only calculated on owning client or server authority
+  return OwnerCharacter && !OwnerCharacter->IsLocallyControlled() &&
+         !OwnerCharacter->HasAuthority();
+}
+
+void UInertialMovementComponent::TickSprings(float DeltaTime) {
+  if (IsRemotePose()) {
     // We are a client looking at another player's character
-    // Skip calculation - use replicated CurrentInertiaState values
+    UpdateSimulatedPose(DeltaTime);
     return;
   }
 
   UpdateInertiaPhysics(DeltaTime);
-  UpdateInertiaPhysics(DeltaTime);
+}
+
+void UInertialMovementComponent::TickGameThread(float DeltaTime) {
+  if (IsRemotePose())
+    return;
+
+  // Turn in place moves the actor: game thread only
   UpdateProceduralTurn(DeltaTime);
   UpdateHeadLookAt(DeltaTime);
 
+  if (OwnerCharacter && OwnerCharacter->HasAuthority()) {
+    UpdateNetPose();
+  }
+
   // Debug display on screen
   if (bShowDebug && GEngine && OwnerCharacter) {
     const FVector Velocity = OwnerCharacter->GetVelocity();
@@ -384,6 +470,17 @@ void UInertialMovementComponent::UpdateProceduralTurn(float DeltaTime) {
   // CurrentInertiaState.TurnVelocity = CurrentTurnVelocity; (DEPRECATED)
 }
 
+void UInertialMovementComponent::SyncHeadLookQuery() {
+  // Same channel / radius as the aim ray: the view query traces both in one
+  // go (to the longer range) instead of a second ray every frame. Without
+  // an aiming component, a Visibility line trace.
+  const ECollisionChannel Channel =
+      AimingComp ? AimingComp->GetAimingTraceChannel() : ECC_Visibility;
+  const float Radius = AimingComp ? AimingComp->AimingRadius : 0.f;
+  ViewQuery->UpdateQuery(HeadLookQuery, Channel, Radius,
+                         HeadLookAtDistance * 10.f);
+}
+
 void UInertialMovementComponent::UpdateHeadLookAt(float DeltaTime) {
   if (!OwnerCharacter || DeltaTime <= 0.001f || DeltaTime > 0.5f) {
     return;
@@ -401,9 +498,22 @@ void UInertialMovementComponent::UpdateHeadLookAt(float DeltaTime) {
   APlayerController *PC =
       Cast<APlayerController>(OwnerCharacter->GetController());
   if (PC) {
+    // Local player: reuse this frame's shared camera ray
+    if (ViewQuery) {
+      SyncHeadLookQuery();
+    }
+    const FViewQueryResult *SharedView =
+        ViewQuery ? &ViewQuery->GetResult(HeadLookQuery) : nullptr;
+    const bool bHasSharedView = SharedView && SharedView->bValid;
+
     FVector CameraLocation;
     FRotator CameraRotation;
-    PC->GetPlayerViewPoint(CameraLocation, CameraRotation);
+    if (bHasSharedView) {
+      CameraLocation = SharedView->ViewLocation;
+      CameraRotation = SharedView->ViewRotation;
+    } else {
+      PC->GetPlayerViewPoint(CameraLocation, CameraRotation);
+    }
 
     const FVector CamForward = CameraRotation.Vector();
 
@@ -411,22 +521,17 @@ void UInertialMovementComponent::UpdateHeadLookAt(float DeltaTime) {
     const float BlendFactor =
         (Speed > IdleSpeedThreshold) ? HeadLookBlendWhenMoving : 1.0f;
 
-    // Calculate look-at point: trace from camera into the world
-    // This gives us the actual point the player is looking at
-    FVector TraceEnd = CameraLocation + CamForward * HeadLookAtDistance * 10.f;
-
-    FHitResult HitResult;
-    FCollisionQueryParams QueryParams;
-    QueryParams.AddIgnoredActor(OwnerCharacter);
-
-    FVector LookAtPoint;
-    if (GetWorld()->LineTraceSingleByChannel(
-            HitResult, CameraLocation, TraceEnd, ECC_Visibility, QueryParams)) {
-      // Hit something - look at that point
-      LookAtPoint = HitResult.ImpactPoint;
-    } else {
-      // Nothing hit - look at far point along camera direction
-      LookAtPoint = CameraLocation + CamForward * HeadLookAtDistance;
+    // Default: far point along camera direction
+    FVector LookAtPoint = CameraLocation + CamForward * HeadLookAtDistance;
+
+    // Calculate look-at point: what the camera ray hit, i.e. the actual
+    // point the player is looking at. Pawns without a local view (server
+    // side, dedicated server) only need the view direction.
+    // With a sweep, the sphere centre at the hit stays on the camera line
+    // where the impact point would be off by up to the aim radius.
+    if (bHasSharedView &&
+        SharedView->HasHitWithin(HeadLookAtDistance * 10.f)) {
+      LookAtPoint = SharedView->Hit.Location;
     }
 
     // Blend between looking forward (actor forward) and looking at camera
@@ -515,3 +620,85 @@ void UInertialMovementComponent::UpdateHeadLookAt(float DeltaTime) {
                          DeltaTime, HeadLookRotationInterpSpeed);
   }
 }
+
+void UInertialMovementComponent::UpdateNetPose() {
+  if (ReplicationMode != EInertiaReplicationMode::Quantized)
+    return;
+
+  const double Now = GetWorld()->GetTimeSeconds();
+  if (LastPoseSendTime >= 0.0 && Now - LastPoseSendTime < 1.0 / PoseSendRate)
+    return;
+
+  // Below the threshold the quantized pose would barely change anyway,
+  // until the small leftover has been held for PoseSettleTime
+  const FRotator HeadDelta =
+      (CurrentHeadLook.HeadLookAtRotation - NetPose.HeadLookAtRotation)
+          .GetNormalized();
+  const float MaxDelta = FMath::Max(
+      FMath::Max3(
+          FMath::Abs(CurrentBodyInertia.LeanRoll - NetPose.LeanRoll),
+          FMath::Abs(CurrentBodyInertia.LeanPitch - NetPose.LeanPitch),
+          FMath::Abs(CurrentBodyInertia.TorsoTwistYaw -
+                     NetPose.TorsoTwistYaw)),
+      FMath::Max3(FMath::Abs(HeadDelta.Pitch), FMath::Abs(HeadDelta.Yaw),
+                  FMath::Abs(HeadDelta.Roll)));
+  if (LastPoseSendTime >= 0.0 && MaxDelta < PoseSendThreshold) {
+    const bool bSettled = MaxDelta > KINDA_SMALL_NUMBER &&
+                          Now - LastPoseSendTime >= PoseSettleTime;
+    if (!bSettled)
+      return;
+  }
+
+  NetPose.LeanRoll = CurrentBodyInertia.LeanRoll;
+  NetPose.LeanPitch = CurrentBodyInertia.LeanPitch;
+  NetPose.TorsoTwistYaw = CurrentBodyInertia.TorsoTwistYaw;
+  NetPose.HeadLookAtRotation = CurrentHeadLook.HeadLookAtRotation;
+  LastPoseSendTime = Now;
+  MARK_PROPERTY_DIRTY_FROM_NAME(UInertialMovementComponent, NetPose, this);
+}
+
+void UInertialMovementComponent::UpdateSimulatedPose(float DeltaTime) {
+  if (!OwnerCharacter || DeltaTime <= 0.f)
+    return;
+
+  if (ReplicationMode == EInertiaReplicationMode::DerivedLocally) {
+    // Same lean springs as the owner, fed by the replicated movement
+    UpdateInertiaPhysics(DeltaTime);
+
+    // No control rotation here: no twist, head follows the replicated aim
+    // (actor yaw + view pitch)
+    CurrentBodyInertia.TorsoTwistYaw =
+        FMath::FInterpTo(CurrentBodyInertia.TorsoTwistYaw, 0.f, DeltaTime,
+                         TorsoResetInterpSpeed);
+
+    ACharacterRope *RopeChar = Cast<ACharacterRope>(OwnerCharacter);
+    const bool bIsQuad =
+        RopeChar && RopeChar->GetStance() == EMonkeyStance::Quadruped;
+    const FLookAtLimits Limits = GetCurrentLimits(bIsQuad);
+
+    FRotator Aim = OwnerCharacter->GetBaseAimRotation();
+    Aim.Pitch = FMath::Clamp(FRotator::NormalizeAxis(Aim.Pitch),
+                             -Limits.MaxPitch, Limits.MaxPitch);
+    Aim.Roll = 0.f;
+    const FRotator TargetRotation =
+        (Aim.Quaternion() * HeadRotationOffset.Quaternion()).Rotator();
+    CurrentHeadLook.HeadLookAtRotation =
+        FMath::RInterpTo(CurrentHeadLook.HeadLookAtRotation, TargetRotation,
+                         DeltaTime, HeadLookRotationInterpSpeed);
+    return;
+  }
+
+  // Chase the last received pose: hides the reduced send rate
+  CurrentBodyInertia.LeanRoll = FMath::FInterpTo(
+      CurrentBodyInertia.LeanRoll, NetPose.LeanRoll, DeltaTime,
+      PoseInterpSpeed);
+  CurrentBodyInertia.LeanPitch = FMath::FInterpTo(
+      CurrentBodyInertia.LeanPitch, NetPose.LeanPitch, DeltaTime,
+      PoseInterpSpeed);
+  CurrentBodyInertia.TorsoTwistYaw = FMath::FInterpTo(
+      CurrentBodyInertia.TorsoTwistYaw, NetPose.TorsoTwistYaw, DeltaTime,
+      PoseInterpSpeed);
+  CurrentHeadLook.HeadLookAtRotation =
+      FMath::RInterpTo(CurrentHeadLook.HeadLookAtRotation,
+                       NetPose.HeadLookAtRotation, DeltaTime, PoseInterpSpeed);
+}
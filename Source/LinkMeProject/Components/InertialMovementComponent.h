@@ -4,7 +4,9 @@
 #include "CoreMinimal.h"
 #include "InertialMovementComponent.generated.h"
 
+class UAimingComponent;
 class UCharacterMovementComponent;
+class UViewQueryComponent;
 
 /**
  * Limits for Head Look At (Yaw/Pitch) per Stance
@@ -62,6 +64,45 @@ struct FHeadLookState {
   FRotator HeadLookAtRotation = FRotator::ZeroRotator;
 };
 
+/** How non-owning clients get the inertia pose */
+UENUM(BlueprintType)
+enum class EInertiaReplicationMode : uint8 {
+  // The server sends a packed, quantized pose (FInertiaNetPose)
+  Quantized,
+  // Nothing is sent: proxies run the lean springs on the replicated velocity
+  // and take the head from the replicated aim
+  DerivedLocally
+};
+
+/**
+ * Lean, twist and head look packed for other clients (54 bits). Purely
+ * cosmetic, so angles are quantized to 8-10 bits (~0.35 deg).
+ */
+USTRUCT()
+struct FInertiaNetPose {
+  GENERATED_BODY()
+
+  UPROPERTY()
+  float LeanRoll = 0.f;
+
+  UPROPERTY()
+  float LeanPitch = 0.f;
+
+  UPROPERTY()
+  float TorsoTwistYaw = 0.f;
+
+  UPROPERTY()
+  FRotator HeadLookAtRotation = FRotator::ZeroRotator;
+
+  bool NetSerialize(FArchive &Ar, UPackageMap *Map, bool &bOutSuccess);
+};
+
+template <>
+struct TStructOpsTypeTraits<FInertiaNetPose>
+    : public TStructOpsTypeTraitsBase2<FInertiaNetPose> {
+  enum { WithNetSerializer = true };
+};
+
 // Delegate for Turn In Place events (for triggering animations)
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnTurnInPlaceStarted, float,
                                             Direction);
@@ -88,10 +129,24 @@ public:
   UFUNCTION(BlueprintPure, Category = "Inertia")
   const FHeadLookState &GetHeadLook() const { return CurrentHeadLook; }
 
+  /**
+   * Lean springs (or the remote pose). Only touches this component and
+   * reads the owner, so independent components can step in parallel,
+   * unless bShowDebug is set.
+   */
+  void TickSprings(float DeltaTime);
+
+  /** Turn in place, head look, net pose, debug. After TickSprings. */
+  void TickGameThread(float DeltaTime);
+
+  bool IsShowingDebug() const { return bShowDebug; }
+
 protected:
   virtual void BeginPlay() override;
   virtual void GetLifetimeReplicatedProps(
       TArray<FLifetimeProperty> &OutLifetimeProps) const override;
+  virtual void
+  PreReplication(IRepChangedPropertyTracker &ChangedPropertyTracker) override;
 
   // --- Debug ---
 
@@ -219,14 +274,48 @@ protected:
   // Helper to get current limits based on Stance
   FLookAtLimits GetCurrentLimits(bool bIsQuadruped) const;
 
+  // --- Replication ---
+
+  // How other players' characters get their lean and head look
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly,
+            Category = "Inertia|Replication")
+  EInertiaReplicationMode ReplicationMode = EInertiaReplicationMode::Quantized;
+
+  // Max rate of pose updates to other clients (Hz)
+  UPROPERTY(EditDefaultsOnly, BlueprintReadWrite,
+            Category = "Inertia|Replication", meta = (ClampMin = "1"))
+  float PoseSendRate = 15.f;
+
+  // A pose is only resent once an angle moved further than this (degrees)
+  UPROPERTY(EditDefaultsOnly, BlueprintReadWrite,
+            Category = "Inertia|Replication", meta = (ClampMin = "0"))
+  float PoseSendThreshold = 1.f;
+
+  // A change held under PoseSendThreshold this long is sent anyway, so the
+  // pose a character settles into reaches other clients (s)
+  UPROPERTY(EditDefaultsOnly, BlueprintReadWrite,
+            Category = "Inertia|Replication", meta = (ClampMin = "0"))
+  float PoseSettleTime = 0.25f;
+
+  // How fast other clients chase the last received pose (1/s)
+  UPROPERTY(EditDefaultsOnly, BlueprintReadWrite,
+            Category = "Inertia|Replication", meta = (ClampMin = "0"))
+  float PoseInterpSpeed = 12.f;
+
   // --- State Data ---
 
-  UPROPERTY(BlueprintReadOnly, Replicated, Category = "Inertia|Output")
+  // Computed locally on the server and the owning client; other clients
+  // rebuild it from NetPose (see ReplicationMode)
+  UPROPERTY(BlueprintReadOnly, Category = "Inertia|Output")
   FBodyInertiaState CurrentBodyInertia;
 
-  UPROPERTY(BlueprintReadOnly, Replicated, Category = "Inertia|Output")
+  UPROPERTY(BlueprintReadOnly, Category = "Inertia|Output")
   FHeadLookState CurrentHeadLook;
 
+  // Last pose sent to other clients (never to the owner)
+  UPROPERTY(Replicated)
+  FInertiaNetPose NetPose;
+
   // Event fired when Turn In Place begins (Direction: +1 = Right, -1 = Left)
   UPROPERTY(BlueprintAssignable, Category = "Inertia|Events")
   FOnTurnInPlaceStarted OnTurnInPlaceStarted;
@@ -238,6 +327,20 @@ private:
   UPROPERTY()
   TObjectPtr<UCharacterMovementComponent> MovementComp;
 
+  // Shared camera ray (local player only; null/invalid elsewhere)
+  UPROPERTY()
+  TObjectPtr<UViewQueryComponent> ViewQuery;
+
+  // Handle of the head look ray in ViewQuery
+  int32 HeadLookQuery = INDEX_NONE;
+
+  // Aim settings the head look ray copies so both share one trace
+  UPROPERTY()
+  TObjectPtr<UAimingComponent> AimingComp;
+
+  // Keep HeadLookQuery on the aim ray's channel / radius
+  void SyncHeadLookQuery();
+
   // Physics State
   FVector PreviousVelocity;
   float PreviousYaw;
@@ -253,7 +356,17 @@ private:
   float CurrentTurnVelocity = 0.f; // Turn In Place angular velocity (deg/sec)
   bool bWasTurning = false;        // For detecting turn start (delegate)
 
+  /** Non-owning client: the pose comes from the server (ReplicationMode) */
+  bool IsRemotePose() const;
+
   void UpdateInertiaPhysics(float DeltaTime);
   void UpdateProceduralTurn(float DeltaTime);
   void UpdateHeadLookAt(float DeltaTime);
+
+  // Replication
+  double LastPoseSendTime = -1.0;
+  // Server: pack the pose for other clients (rate + threshold limited)
+  void UpdateNetPose();
+  // Other clients: chase NetPose, or derive the pose locally
+  void UpdateSimulatedPose(float DeltaTime);
 };
@@ -0,0 +1,187 @@
+#include "Components/ViewQueryComponent.h"
+#include "../LinkMeProject.h"
+#include "DrawDebugHelpers.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+
+DECLARE_CYCLE_STAT(TEXT("View Query"), STAT_ViewQuery, STATGROUP_LinkMe);
+DECLARE_DWORD_COUNTER_STAT(TEXT("View Query Traces"), STAT_ViewQueryTraces,
+                           STATGROUP_LinkMe);
+
+UViewQueryComponent::UViewQueryComponent() {
+  PrimaryComponentTick.bCanEverTick = true;
+  // After UpdateCameraManager: the cached camera view is this frame's
+  PrimaryComponentTick.TickGroup = TG_PostUpdateWork;
+}
+
+void UViewQueryComponent::BeginPlay() {
+  Super::BeginPlay();
+
+  // No local players on a dedicated server
+  if (!LinkMe::ShouldRunCosmetics(GetWorld())) {
+    SetComponentTickEnabled(false);
+    return;
+  }
+
+  RebuildQueryParams();
+}
+
+int32 UViewQueryComponent::AddQuery(ECollisionChannel Channel, float Radius,
+                                    float Range) {
+  FQuery &Query = Queries.AddDefaulted_GetRef();
+  Query.Channel = Channel;
+  Query.Radius = Radius;
+  Query.Range = Range;
+  bForceRefresh = true;
+  return Queries.Num() - 1;
+}
+
+void UViewQueryComponent::UpdateQuery(int32 Query, ECollisionChannel Channel,
+                                      float Radius, float Range) {
+  if (!Queries.IsValidIndex(Query))
+    return;
+
+  FQuery &Entry = Queries[Query];
+  if (Entry.Channel != Channel || Entry.Radius != Radius ||
+      Entry.Range != Range) {
+    Entry.Channel = Channel;
+    Entry.Radius = Radius;
+    Entry.Range = Range;
+    bForceRefresh = true;
+  }
+}
+
+const FViewQueryResult &UViewQueryComponent::GetResult(int32 Query) const {
+  static const FViewQueryResult Invalid;
+  return Queries.IsValidIndex(Query) ? Queries[Query].Result : Invalid;
+}
+
+void UViewQueryComponent::RebuildQueryParams() {
+  QueryParams = FCollisionQueryParams(SCENE_QUERY_STAT(ViewQuery), false);
+
+  AActor *Owner = GetOwner();
+  if (!Owner) {
+    CachedComponentCount = INDEX_NONE;
+    return;
+  }
+
+  QueryParams.AddIgnoredActor(Owner);
+
+  // Also ignore all components attached to owner (mesh, capsule, etc.)
+  for (UActorComponent *Comp : Owner->GetComponents()) {
+    if (UPrimitiveComponent *PrimComp = Cast<UPrimitiveComponent>(Comp)) {
+      QueryParams.AddIgnoredComponent(PrimComp);
+    }
+  }
+  CachedComponentCount = Owner->GetComponents().Num();
+}
+
+void UViewQueryComponent::TickComponent(
+    float DeltaTime, ELevelTick TickType,
+    FActorComponentTickFunction *ThisTickFunction) {
+  Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+  SCOPE_CYCLE_COUNTER(STAT_ViewQuery);
+
+  const APawn *OwnerPawn = Cast<APawn>(GetOwner());
+  APlayerController *PC =
+      OwnerPawn ? Cast<APlayerController>(OwnerPawn->GetController())
+                : nullptr;
+  if (!PC || !PC->IsLocalController()) {
+    if (bHasView) {
+      bHasView = false;
+      for (FQuery &Query : Queries) {
+        Query.Result.bValid = false;
+      }
+    }
+    return;
+  }
+
+  FVector ViewLocation;
+  FRotator ViewRotation;
+  PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+  TimeSinceTrace += DeltaTime;
+
+  // Still view: the previous hits are still the answer
+  const bool bViewUnchanged =
+      bHasView && ViewLocation.Equals(LastViewLocation, LocationTolerance) &&
+      ViewRotation.Equals(LastViewRotation, RotationTolerance);
+  if (bViewUnchanged && !bForceRefresh && TimeSinceTrace < MaxStaleTime) {
+    return;
+  }
+
+  if (GetOwner()->GetComponents().Num() != CachedComponentCount) {
+    RebuildQueryParams();
+  }
+
+  bHasView = true;
+  LastViewLocation = ViewLocation;
+  LastViewRotation = ViewRotation;
+  TraceQueries(ViewLocation, ViewRotation);
+
+  TimeSinceTrace = 0.f;
+  bForceRefresh = false;
+}
+
+void UViewQueryComponent::TraceQueries(const FVector &ViewLocation,
+                                       const FRotator &ViewRotation) {
+  const FVector ViewDirection = ViewRotation.Vector();
+  const auto SharesTrace = [](const FQuery &A, const FQuery &B) {
+    return A.Channel == B.Channel && A.Radius == B.Radius;
+  };
+
+  for (int32 Index = 0; Index < Queries.Num(); ++Index) {
+    // Already traced along with an earlier ray of the same shape
+    bool bTraced = false;
+    for (int32 Prev = 0; Prev < Index && !bTraced; ++Prev) {
+      bTraced = SharesTrace(Queries[Prev], Queries[Index]);
+    }
+    if (bTraced)
+      continue;
+
+    const FQuery &Query = Queries[Index];
+    float Range = 0.f;
+    for (int32 Other = Index; Other < Queries.Num(); ++Other) {
+      if (SharesTrace(Query, Queries[Other])) {
+        Range = FMath::Max(Range, Queries[Other].Range);
+      }
+    }
+
+    FViewQueryResult Result;
+    Result.bValid = true;
+    Result.ViewLocation = ViewLocation;
+    Result.ViewRotation = ViewRotation;
+    Result.TraceEnd = ViewLocation + ViewDirection * Range;
+
+    if (Range > 0.f) {
+      if (Query.Radius > 0.f) {
+        Result.bHit = GetWorld()->SweepSingleByChannel(
+            Result.Hit, ViewLocation, Result.TraceEnd, FQuat::Identity,
+            Query.Channel, FCollisionShape::MakeSphere(Query.Radius),
+            QueryParams);
+      } else {
+        Result.bHit = GetWorld()->LineTraceSingleByChannel(
+            Result.Hit, ViewLocation, Result.TraceEnd, Query.Channel,
+            QueryParams);
+      }
+      INC_DWORD_STAT(STAT_ViewQueryTraces);
+    }
+
+    if (bShowDebug) {
+      DrawDebugLine(GetWorld(), ViewLocation, Result.TraceEnd,
+                    Result.bHit ? FColor::Green : FColor::Red, false, -1.f, 0,
+                    1.f);
+      if (Result.bHit) {
+        DrawDebugSphere(GetWorld(), Result.Hit.ImpactPoint, 10.f, 12,
+                        FColor::Yellow, false, -1.f);
+      }
+    }
+
+    for (int32 Other = Index; Other < Queries.Num(); ++Other) {
+      if (SharesTrace(Query, Queries[Other])) {
+        Queries[Other].Result = Result;
+      }
+    }
+  }
+}
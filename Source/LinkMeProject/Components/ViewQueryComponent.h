@@ -0,0 +1,128 @@
+#pragma once
+
+#include "Components/ActorComponent.h"
+#include "CoreMinimal.h"
+#include "Engine/HitResult.h"
+#include "ViewQueryComponent.generated.h"
+
+/**
+ * Result of the shared camera ray for one frame
+ */
+USTRUCT(BlueprintType)
+struct FViewQueryResult {
+  GENERATED_BODY()
+
+  /** False until a local view has been traced at least once */
+  UPROPERTY(BlueprintReadOnly, Category = "View Query")
+  bool bValid = false;
+
+  UPROPERTY(BlueprintReadOnly, Category = "View Query")
+  FVector ViewLocation = FVector::ZeroVector;
+
+  UPROPERTY(BlueprintReadOnly, Category = "View Query")
+  FRotator ViewRotation = FRotator::ZeroRotator;
+
+  /** ViewLocation + forward * the traced range */
+  UPROPERTY(BlueprintReadOnly, Category = "View Query")
+  FVector TraceEnd = FVector::ZeroVector;
+
+  UPROPERTY(BlueprintReadOnly, Category = "View Query")
+  bool bHit = false;
+
+  UPROPERTY(BlueprintReadOnly, Category = "View Query")
+  FHitResult Hit;
+
+  FVector GetViewDirection() const { return ViewRotation.Vector(); }
+
+  /** True if the ray hit something closer than Range (consumers have their
+   * own max distance, the trace uses the largest one) */
+  bool HasHitWithin(float Range) const { return bHit && Hit.Distance <= Range; }
+};
+
+/**
+ * Camera rays of the local player, traced once per frame and shared by aim,
+ * magnetism, head look-at and the hook trajectory.
+ *
+ * Each consumer registers its ray (channel, sweep radius, range) and reads the
+ * result through the returned handle. Rays with the same channel and radius
+ * are traced once, to the longest of their ranges; different ones each get
+ * their own trace from the same view.
+ *
+ * Ticks in TG_PostUpdateWork, after the player camera manager has updated the
+ * view, so consumers ticking next frame read the same view they would get
+ * from GetPlayerViewPoint. The traces are skipped while the view transform
+ * does not move (up to MaxStaleTime, so moving geometry is still picked up).
+ */
+UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
+class LINKMEPROJECT_API UViewQueryComponent : public UActorComponent {
+  GENERATED_BODY()
+
+public:
+  UViewQueryComponent();
+
+  virtual void BeginPlay() override;
+  virtual void
+  TickComponent(float DeltaTime, ELevelTick TickType,
+                FActorComponentTickFunction *ThisTickFunction) override;
+
+  /** Register a ray on Channel (Radius 0 = line trace) and return its
+   * handle. Its result is valid from the next tick on. */
+  int32 AddQuery(ECollisionChannel Channel, float Radius, float Range);
+
+  /** Change a registered ray, e.g. after its settings were edited at
+   * runtime. Re-traces on the next tick only if something changed. */
+  void UpdateQuery(int32 Query, ECollisionChannel Channel, float Radius,
+                   float Range);
+
+  /** Last result of a registered ray (invalid for an unknown handle) */
+  UFUNCTION(BlueprintPure, Category = "View Query")
+  const FViewQueryResult &GetResult(int32 Query) const;
+
+  UFUNCTION(BlueprintPure, Category = "View Query")
+  bool HasView() const { return bHasView; }
+
+  /** Force fresh traces on the next tick */
+  void Invalidate() { bForceRefresh = true; }
+
+  /** Re-trace at least this often even if the view is still (s) */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "View Query",
+            meta = (ClampMin = "0"))
+  float MaxStaleTime = 0.1f;
+
+  /** View moves smaller than this reuse the previous hit (cm / deg) */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "View Query")
+  float LocationTolerance = 0.1f;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "View Query")
+  float RotationTolerance = 0.01f;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Debug")
+  bool bShowDebug = false;
+
+private:
+  struct FQuery {
+    TEnumAsByte<ECollisionChannel> Channel = ECC_Visibility;
+    float Radius = 0.f;
+    float Range = 0.f;
+    FViewQueryResult Result;
+  };
+
+  void RebuildQueryParams();
+
+  /** One trace per distinct channel / radius, copied to every ray using it */
+  void TraceQueries(const FVector &ViewLocation, const FRotator &ViewRotation);
+
+  TArray<FQuery, TInlineAllocator<2>> Queries;
+
+  bool bHasView = false;
+  FVector LastViewLocation = FVector::ZeroVector;
+  FRotator LastViewRotation = FRotator::ZeroRotator;
+
+  float TimeSinceTrace = 0.f;
+  bool bForceRefresh = true;
+
+  /** Owner + its primitives; rebuilt only when the owner's components
+   * change instead of calling GetComponents every frame */
+  FCollisionQueryParams QueryParams;
+  int32 CachedComponentCount = INDEX_NONE;
+};
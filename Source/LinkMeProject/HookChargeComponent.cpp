@@ -2,6 +2,7 @@
 #include "Kismet/GameplayStatics.h"
 #include "GameFramework/Actor.h"
 #include "DrawDebugHelpers.h"
+#include "Engine/World.h"
 
 UHookChargeComponent::UHookChargeComponent()
 {
@@ -150,24 +151,16 @@ bool UHookChargeComponent::StopChargingAndGetVelocity(FVector& OutVelocity)
 	
 	FVector Dir = (TargetLocation - StartPosition).GetSafeNormal();
 	
-	// Si Focus Mode et Reachable, SuggestProjectileVelocity nous donne le vecteur EXACT
+	// Si Focus Mode et Reachable, l'arc bas analytique nous donne le vecteur EXACT
 	if (bIsFocusMode && bTargetReachable)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("StopCharging: Focus Mode Active. TargetReachable. Recalculating Arc."));
-		// On recalculer l'arc pour la vitesse actuelle
-		PRAGMA_DISABLE_DEPRECATION_WARNINGS
-		UGameplayStatics::SuggestProjectileVelocity(
-			GetWorld(),
-			OutVelocity,
-			StartPosition,
-			TargetLocation,
-			CurrentLaunchSpeed,
-			false,
-			0.f,
-			0.f,
-			ESuggestProjVelocityTraceOption::DoNotTrace
-		);
-		PRAGMA_ENABLE_DEPRECATION_WARNINGS
+		// On recalcule l'arc pour la vitesse actuelle (sous-chargé : pas de solution, vélocité nulle)
+		FVector HighArc;
+		if (!SolveLaunchVelocities(StartPosition, TargetLocation, CurrentLaunchSpeed, GetGravity(), OutVelocity, HighArc))
+		{
+			OutVelocity = FVector::ZeroVector;
+		}
 	}
 	else
 	{
@@ -206,108 +199,196 @@ float UHookChargeComponent::CalculateRequiredSpeed(const FVector& Start, const F
 {
 	if (!GetWorld()) return MinLaunchSpeed;
 
-	float Low = MinLaunchSpeed;
-	float High = MaxLaunchSpeed;
-	float BestSpeed = MaxLaunchSpeed;
-	bool bFoundSolution = false;
+	// Même point qu'un calcul récent (sous le seuil de "cible bougée") ?
+	constexpr float SolvedTargetTolerance = 10.0f;
+	const double Now = GetWorld()->GetTimeSeconds();
 
-	// Direction initiale approximative
-	FVector Direction = (Target - Start).GetSafeNormal();
+	const FSolvedTarget* Solved = nullptr;
+	for (const FSolvedTarget& Entry : SolvedTargets)
+	{
+		if (Entry.SolveTime >= 0.0 && (Now - Entry.SolveTime) < RecalcInterval &&
+			FVector::DistSquared(Entry.Target, Target) <= FMath::Square(SolvedTargetTolerance) &&
+			FVector::DistSquared(Entry.Start, Start) <= FMath::Square(SolvedTargetTolerance))
+		{
+			Solved = &Entry;
+			break;
+		}
+	}
 
-	for (int32 Iteration = 0; Iteration < BinarySearchIterations; ++Iteration)
+	if (!Solved)
 	{
-		float MidSpeed = (Low + High) * 0.5f;
+		FSolvedTarget& Entry = SolvedTargets[NextSolvedTarget];
+		NextSolvedTarget = (NextSolvedTarget + 1) % NumSolvedTargets;
 
-		// Tester si cette vitesse permet d'atteindre la cible
-		bool bCanHit = TestProjectileHit(Start, Direction, MidSpeed, Target, HitTolerance);
+		const float Gravity = GetGravity();
 
-		if (bCanHit)
-		{
-			// Succès : cette vitesse fonctionne, essayer plus bas (pour trouver la vitesse minimale requise)
-			BestSpeed = MidSpeed;
-			High = MidSpeed;
-			bFoundSolution = true;
-		}
-		else
+		// Vitesse minimale analytique ; en dessous de MinLaunchSpeed la charge 0 suffit
+		const float Speed = FMath::Max(ComputeMinimumSpeed(Start, Target, Gravity), MinLaunchSpeed);
+
+		bool bReachable = Speed <= MaxLaunchSpeed;
+		if (bReachable)
 		{
-			// Échec : vitesse trop faible, essayer plus haut
-			Low = MidSpeed;
+			// Une seule vérification de collision, sur l'arc tiré (arc bas)
+			FVector LowArc, HighArc;
+			bReachable = SolveLaunchVelocities(Start, Target, Speed, Gravity, LowArc, HighArc) &&
+				SimulateAndCheckHit(Start, LowArc, Target, HitTolerance);
 		}
+
+		Entry.Start = Start;
+		Entry.Target = Target;
+		Entry.RequiredSpeed = bReachable ? Speed : MaxLaunchSpeed;
+		Entry.bReachable = bReachable;
+		Entry.SolveTime = Now;
+		Solved = &Entry;
 	}
 
-	bTargetReachable = bFoundSolution;
+	bTargetReachable = Solved->bReachable;
 
-	if (!bFoundSolution)
+	if (!bTargetReachable)
 	{
 		OnTargetUnreachable.Broadcast();
 		return MaxLaunchSpeed; // Retourne Max si inaccessible
 	}
 
-	return BestSpeed;
+	return Solved->RequiredSpeed;
 }
 
-bool UHookChargeComponent::TestProjectileHit(const FVector& Start, const FVector& InitialDirection, float Speed, const FVector& Target, float Tolerance)
+float UHookChargeComponent::GetGravity() const
 {
-	// 1. Tenter SuggestProjectileVelocity (Analytique, rapide)
-	FVector OutVelocity;
-	
-	
-	// Utilisation de la signature classique avec suppression du warning deprecated
-	PRAGMA_DISABLE_DEPRECATION_WARNINGS
-	bool bSuccess = UGameplayStatics::SuggestProjectileVelocity(
-		GetWorld(),
-		OutVelocity,
-		Start,
-		Target,
-		Speed,
-		false,
-		0.0f,
-		0.0f,
-		ESuggestProjVelocityTraceOption::DoNotTrace
-	);
-	PRAGMA_ENABLE_DEPRECATION_WARNINGS
-
-	if (bSuccess)
+	const UWorld* World = GetWorld();
+	return World ? -World->GetGravityZ() : 980.0f;
+}
+
+float UHookChargeComponent::ComputeMinimumSpeed(const FVector& Start, const FVector& Target, float Gravity)
+{
+	const FVector Delta = Target - Start;
+	const double X = Delta.Size2D();
+	const double Y = Delta.Z;
+
+	// v² = g (y + |d|) : l'angle de tir est la bissectrice de la verticale et de la direction de la cible
+	const double SpeedSq = Gravity * (Y + FMath::Sqrt(X * X + Y * Y));
+	return FMath::Sqrt(FMath::Max(0.0, SpeedSq));
+}
+
+bool UHookChargeComponent::SolveLaunchVelocities(const FVector& Start, const FVector& Target, float Speed, float Gravity,
+	FVector& OutLowArc, FVector& OutHighArc)
+{
+	const FVector Delta = Target - Start;
+	const double X = Delta.Size2D();
+	const double Y = Delta.Z;
+	const double V = Speed;
+	const double V2 = V * V;
+	const double G = Gravity;
+
+	// Sans gravité : tir direct
+	if (G <= KINDA_SMALL_NUMBER)
 	{
+		OutLowArc = OutHighArc = Delta.GetSafeNormal() * V;
+		return V > 0.0;
+	}
+
+	// Cible à la verticale : tir droit vers le haut (ou vers le bas pour l'arc bas)
+	if (X < KINDA_SMALL_NUMBER)
+	{
+		if (Y > 0.0 && V2 < 2.0 * G * Y) return false;
+		OutHighArc = FVector::UpVector * V;
+		OutLowArc = (Y > 0.0) ? OutHighArc : -OutHighArc;
 		return true;
 	}
 
-	// 2. Fallback: Simulation physique (plus lent mais gère collisions)
-	return false;
+	double Discriminant = V2 * V2 - G * (G * X * X + 2.0 * Y * V2);
+	if (Discriminant < 0.0)
+	{
+		// Pile à la vitesse minimale, la racine vaut 0 aux arrondis près
+		if (Discriminant < -1.0e-6 * V2 * V2) return false;
+		Discriminant = 0.0;
+	}
+
+	const double Root = FMath::Sqrt(Discriminant);
+	const FVector Horizontal = FVector(Delta.X, Delta.Y, 0.0) / X;
+
+	auto MakeVelocity = [&](double TanTheta)
+	{
+		// cos = 1 / sqrt(1 + tan²), sin = tan * cos (pas de trigo)
+		const double Cos = 1.0 / FMath::Sqrt(1.0 + TanTheta * TanTheta);
+		return Horizontal * (V * Cos) + FVector::UpVector * (V * TanTheta * Cos);
+	};
+
+	OutLowArc = MakeVelocity((V2 - Root) / (G * X));
+	OutHighArc = MakeVelocity((V2 + Root) / (G * X));
+	return true;
 }
 
 bool UHookChargeComponent::SimulateAndCheckHit(const FVector& Start, const FVector& LaunchVelocity, const FVector& Target, float Tolerance)
 {
-	FPredictProjectilePathParams PredictParams;
-	PredictParams.StartLocation = Start;
-	PredictParams.LaunchVelocity = LaunchVelocity;
-	PredictParams.bTraceWithCollision = true;
-	PredictParams.bTraceComplex = false;
-	PredictParams.ProjectileRadius = 5.0f;
-	PredictParams.MaxSimTime = 2.0f;
-	PredictParams.SimFrequency = 15.0f;
-	PredictParams.TraceChannel = ProjectileTraceChannel;
-	PredictParams.ActorsToIgnore.Add(GetOwner());
-
-	FPredictProjectilePathResult PredictResult;
-	bool bHit = UGameplayStatics::PredictProjectilePath(GetWorld(), PredictParams, PredictResult);
-
-	if (bHit && PredictResult.HitResult.bBlockingHit)
+	UWorld* World = GetWorld();
+	if (!World) return false;
+
+	const double G = GetGravity();
+	const FVector Delta = Target - Start;
+
+	// Temps de vol jusqu'à la cible
+	double FlightTime = 0.0;
+	const double HorizontalSpeed = FVector(LaunchVelocity.X, LaunchVelocity.Y, 0.0).Size();
+	if (HorizontalSpeed > KINDA_SMALL_NUMBER)
 	{
-		float DistanceToTarget = FVector::Dist(PredictResult.HitResult.ImpactPoint, Target);
-		return DistanceToTarget <= Tolerance;
+		FlightTime = Delta.Size2D() / HorizontalSpeed;
 	}
+	else if (G > KINDA_SMALL_NUMBER)
+	{
+		// Tir vertical : Vz t - g t² / 2 = dz, premier passage
+		const double Vz = LaunchVelocity.Z;
+		const double Disc = Vz * Vz - 2.0 * G * Delta.Z;
+		if (Disc < 0.0) return false;
+		FlightTime = (Vz - FMath::Sqrt(Disc)) / G;
+		if (FlightTime < 0.0) FlightTime = (Vz + FMath::Sqrt(Disc)) / G;
+	}
+	else if (!LaunchVelocity.IsNearlyZero())
+	{
+		FlightTime = Delta.Size() / LaunchVelocity.Size();
+	}
+	if (FlightTime <= 0.0) return false;
+
+	auto PositionAt = [&](double Time)
+	{
+		return Start + LaunchVelocity * Time + FVector(0.0, 0.0, -0.5 * G * Time * Time);
+	};
+
+	// Sweep de l'arc par segments (même résolution que l'ancien PredictProjectilePath)
+	constexpr double SweepFrequency = 15.0;
+	const int32 NumSegments = FMath::Clamp(FMath::CeilToInt(FlightTime * SweepFrequency), 1, 32);
+
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(HookArcCheck), false, GetOwner());
+	const FCollisionShape Sphere = FCollisionShape::MakeSphere(ProjectileRadius);
 
-	// Pas de hit direct, vérifier la trajectoire
-	for (const FPredictProjectilePathPointData& Point : PredictResult.PathData)
+	FVector SegmentStart = Start;
+	for (int32 i = 1; i <= NumSegments; ++i)
 	{
-		if (FVector::Dist(Point.Location, Target) <= Tolerance)
+		// Dernier segment : exactement sur la cible
+		const FVector SegmentEnd = (i == NumSegments) ? Target : PositionAt(FlightTime * i / NumSegments);
+
+		FHitResult Hit;
+		if (World->SweepSingleByChannel(Hit, SegmentStart, SegmentEnd, FQuat::Identity, ProjectileTraceChannel, Sphere, Params))
+		{
+			const bool bHitTarget = FVector::Dist(Hit.ImpactPoint, Target) <= Tolerance;
+			if (bShowDebug)
+			{
+				const FColor Color = bHitTarget ? FColor::Green : FColor::Red;
+				DrawDebugLine(World, SegmentStart, Hit.Location, Color, false, RecalcInterval);
+				DrawDebugSphere(World, Hit.ImpactPoint, 10.f, 8, Color, false, RecalcInterval);
+			}
+			return bHitTarget;
+		}
+
+		if (bShowDebug)
 		{
-			return true;
+			DrawDebugLine(World, SegmentStart, SegmentEnd, FColor::Green, false, RecalcInterval);
 		}
+		SegmentStart = SegmentEnd;
 	}
 
-	return false;
+	// Aucun obstacle jusqu'à la cible
+	return true;
 }
 
 float UHookChargeComponent::ChargeToSpeed(float InCharge) const
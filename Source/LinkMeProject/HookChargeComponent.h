@@ -117,13 +117,14 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hook Charge|Focus")
 	float HitTolerance = 50.0f;
 
-	/** Nombre d'itérations de recherche binaire */
+	/** Intervalle de recalcul de la vitesse requise (secondes).
+	 * Aussi la durée de vie d'une cible en cache : la vérification de collision peut devenir obsolète. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hook Charge|Focus")
-	int32 BinarySearchIterations = 10;
+	float RecalcInterval = 0.1f;
 
-	/** Intervalle de recalcul de la vitesse requise (secondes) */
+	/** Rayon du projectile pour la vérification de collision de l'arc */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hook Charge|Focus")
-	float RecalcInterval = 0.1f;
+	float ProjectileRadius = 5.0f;
 
 	/** Epsilon pour considérer la charge "parfaite" (% de RequiredCharge) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hook Charge|Focus")
@@ -137,6 +138,12 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Debug")
 	bool bShowDebug = false;
 
+	/** Obsolète : la recherche binaire est remplacée par la solution
+	 * analytique. Gardé sous son nom pour les Blueprints qui le lisent. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hook Charge|Focus",
+		meta = (DeprecatedProperty, DeprecationMessage = "Ignored: the perfect charge is now solved analytically."))
+	int32 BinarySearchIterations = 10;
+
 	// ===================================================================
 	// EVENTS
 	// ===================================================================
@@ -156,17 +163,29 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Hook Charge|Events")
 	FOnChargeFired OnChargeFired;
 
+	// ===================================================================
+	// BALLISTIQUE (forme fermée, gravité constante, sans frottement)
+	// ===================================================================
+
+	/** Vitesse minimale pour atteindre Target : v² = g (y + sqrt(x² + y²)) */
+	static float ComputeMinimumSpeed(const FVector& Start, const FVector& Target, float Gravity);
+
+	/**
+	 * Les deux vélocités de lancer de norme Speed qui passent par Target :
+	 * tan(theta) = (v² -/+ sqrt(v⁴ - g (g x² + 2 y v²))) / (g x).
+	 * @return false si Speed est sous la vitesse minimale (pas de solution réelle)
+	 */
+	static bool SolveLaunchVelocities(const FVector& Start, const FVector& Target, float Speed, float Gravity,
+		FVector& OutLowArc, FVector& OutHighArc);
+
+	/** Gravité du monde (positive, cm/s²) */
+	float GetGravity() const;
+
 protected:
 	// Helpers
 	float CalculateRequiredSpeed(const FVector& Start, const FVector& Target);
-	
-	bool TestProjectileHit(
-		const FVector& Start, 
-		const FVector& InitialDirection,
-		float Speed,
-		const FVector& Target,
-		float Tolerance);
-		
+
+	/** Sweep de l'arc analytique jusqu'à Target ; true si rien ne le bloque avant */
 	bool SimulateAndCheckHit(
 		const FVector& Start,
 		const FVector& LaunchVelocity,
@@ -211,4 +230,18 @@ protected:
 	float TimeSinceLastRecalc = 0.0f;
 	FVector CachedTargetLocation = FVector::ZeroVector;
 	bool bRequiresRecalc = true;
+
+	/** Cibles déjà résolues, réutilisées quand le joueur alterne entre quelques points */
+	struct FSolvedTarget
+	{
+		FVector Start = FVector::ZeroVector;
+		FVector Target = FVector::ZeroVector;
+		float RequiredSpeed = 0.0f;
+		bool bReachable = false;
+		double SolveTime = -1.0;
+	};
+
+	static constexpr int32 NumSolvedTargets = 4;
+	FSolvedTarget SolvedTargets[NumSolvedTargets];
+	int32 NextSolvedTarget = 0;
 };
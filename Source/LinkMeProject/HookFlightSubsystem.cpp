@@ -0,0 +1,59 @@
+// HookFlightSubsystem.cpp
+
+#include "HookFlightSubsystem.h"
+#include "LinkMeProject.h"
+#include "RopeHookActor.h"
+
+DECLARE_CYCLE_STAT(TEXT("Hook Flight"), STAT_HookFlight, STATGROUP_LinkMe);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Hooks In Flight"), STAT_HooksInFlight,
+                           STATGROUP_LinkMe);
+
+void UHookFlightSubsystem::Deinitialize() {
+  ActiveHooks.Empty();
+  Super::Deinitialize();
+}
+
+bool UHookFlightSubsystem::DoesSupportWorldType(
+    const EWorldType::Type WorldType) const {
+  return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UHookFlightSubsystem::GetStatId() const {
+  RETURN_QUICK_DECLARE_CYCLE_STAT(UHookFlightSubsystem, STATGROUP_LinkMe);
+}
+
+void UHookFlightSubsystem::RegisterHook(ARopeHookActor *Hook) {
+  if (IsValid(Hook)) {
+    ActiveHooks.AddUnique(Hook);
+  }
+}
+
+void UHookFlightSubsystem::UnregisterHook(ARopeHookActor *Hook) {
+  // Inside Tick the hook is no longer flying and gets compacted after the loop
+  if (!bTickingHooks) {
+    ActiveHooks.RemoveSingleSwap(Hook);
+  }
+}
+
+void UHookFlightSubsystem::Tick(float DeltaTime) {
+  SCOPE_CYCLE_COUNTER(STAT_HookFlight);
+
+  if (DeltaTime <= 0.f)
+    return;
+
+  bTickingHooks = true;
+  // Indexed loop: an impact callback may fire (and register) another hook
+  for (int32 i = 0; i < ActiveHooks.Num(); ++i) {
+    ARopeHookActor *Hook = ActiveHooks[i].Get();
+    if (IsValid(Hook) && Hook->IsFlying()) {
+      Hook->TickFlight(DeltaTime);
+    }
+  }
+  bTickingHooks = false;
+
+  ActiveHooks.RemoveAllSwap([](const TWeakObjectPtr<ARopeHookActor> &Hook) {
+    return !Hook.IsValid() || !Hook->IsFlying();
+  });
+
+  INC_DWORD_STAT_BY(STAT_HooksInFlight, ActiveHooks.Num());
+}
@@ -0,0 +1,45 @@
+// HookFlightSubsystem.h
+// Batched ballistic flight for rope hooks
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "HookFlightSubsystem.generated.h"
+
+class ARopeHookActor;
+
+/**
+ * Advances every hook in flight from a single tick function.
+ *
+ * Hooks register when fired and leave when they stop (impact, reel-in,
+ * EndPlay). The per-hook step itself lives in ARopeHookActor::TickFlight;
+ * this only replaces one actor tick + one movement component tick per hook
+ * with one loop.
+ */
+UCLASS()
+class LINKMEPROJECT_API UHookFlightSubsystem : public UTickableWorldSubsystem {
+  GENERATED_BODY()
+
+public:
+  virtual void Deinitialize() override;
+
+  virtual void Tick(float DeltaTime) override;
+  virtual TStatId GetStatId() const override;
+  virtual bool IsTickable() const override { return ActiveHooks.Num() > 0; }
+
+  void RegisterHook(ARopeHookActor *Hook);
+  void UnregisterHook(ARopeHookActor *Hook);
+
+  int32 GetNumActiveHooks() const { return ActiveHooks.Num(); }
+
+protected:
+  virtual bool DoesSupportWorldType(
+      const EWorldType::Type WorldType) const override;
+
+private:
+  TArray<TWeakObjectPtr<ARopeHookActor>> ActiveHooks;
+
+  /** Hooks stopping mid-loop are compacted after it */
+  bool bTickingHooks = false;
+};
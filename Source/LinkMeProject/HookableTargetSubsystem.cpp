@@ -0,0 +1,303 @@
+// HookableTargetSubsystem.cpp
+
+#include "HookableTargetSubsystem.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "LinkMeProject.h"
+
+DECLARE_CYCLE_STAT(TEXT("Hookable Cone Query"), STAT_HookableConeQuery,
+                   STATGROUP_LinkMe);
+
+const FName UHookableTargetSubsystem::DefaultHookableTag(TEXT("Hookable"));
+
+void UHookableTargetSubsystem::Initialize(
+    FSubsystemCollectionBase &Collection) {
+  Super::Initialize(Collection);
+
+  IndexedTags.Add(DefaultHookableTag);
+
+  if (UWorld *World = GetWorld()) {
+    ActorSpawnedHandle = World->AddOnActorSpawnedHandler(
+        FOnActorSpawned::FDelegate::CreateUObject(
+            this, &UHookableTargetSubsystem::HandleActorSpawned));
+  }
+
+  // Streamed levels and World Partition cells load after BeginPlay; their
+  // actors are neither spawned nor seen by the BeginPlay pass
+  LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(
+      this, &UHookableTargetSubsystem::HandleLevelAdded);
+  LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(
+      this, &UHookableTargetSubsystem::HandleLevelRemoved);
+}
+
+void UHookableTargetSubsystem::Deinitialize() {
+  if (UWorld *World = GetWorld()) {
+    World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+  }
+  ActorSpawnedHandle.Reset();
+
+  FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+  FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+  LevelAddedHandle.Reset();
+  LevelRemovedHandle.Reset();
+
+  Cells.Empty();
+  CellByActor.Empty();
+  MovingTargets.Empty();
+
+  Super::Deinitialize();
+}
+
+void UHookableTargetSubsystem::OnWorldBeginPlay(UWorld &InWorld) {
+  Super::OnWorldBeginPlay(InWorld);
+
+  // Level-placed actors never go through the spawn handler
+  for (TActorIterator<AActor> It(&InWorld); It; ++It) {
+    if (HasIndexedTag(*It)) {
+      RegisterTarget(*It);
+    }
+  }
+}
+
+bool UHookableTargetSubsystem::DoesSupportWorldType(
+    const EWorldType::Type WorldType) const {
+  return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+// ===================================================================
+// REGISTRATION
+// ===================================================================
+
+void UHookableTargetSubsystem::RegisterTarget(AActor *Actor) {
+  if (!IsValid(Actor) || CellByActor.Contains(Actor) ||
+      MovingTargets.Contains(Actor)) {
+    return;
+  }
+
+  const USceneComponent *Root = Actor->GetRootComponent();
+  if (Root && Root->Mobility == EComponentMobility::Movable) {
+    MovingTargets.Add(Actor);
+  } else {
+    const FIntVector Cell = GetCell(Actor->GetActorLocation());
+    Cells.FindOrAdd(Cell).Add(Actor);
+    CellByActor.Add(Actor, Cell);
+  }
+
+  Actor->OnEndPlay.AddUniqueDynamic(
+      this, &UHookableTargetSubsystem::HandleActorEndPlay);
+}
+
+void UHookableTargetSubsystem::UnregisterTarget(AActor *Actor) {
+  if (!Actor)
+    return;
+
+  FIntVector Cell;
+  if (CellByActor.RemoveAndCopyValue(Actor, Cell)) {
+    RemoveFromCell(Actor, Cell);
+  } else {
+    MovingTargets.RemoveSingleSwap(Actor);
+  }
+
+  Actor->OnEndPlay.RemoveDynamic(this,
+                                 &UHookableTargetSubsystem::HandleActorEndPlay);
+}
+
+void UHookableTargetSubsystem::AddIndexedTag(FName Tag) {
+  if (Tag.IsNone())
+    return;
+
+  bool bAlreadyIndexed = false;
+  IndexedTags.Add(Tag, &bAlreadyIndexed);
+  if (bAlreadyIndexed)
+    return;
+
+  if (UWorld *World = GetWorld()) {
+    for (TActorIterator<AActor> It(World); It; ++It) {
+      if (It->ActorHasTag(Tag)) {
+        RegisterTarget(*It);
+      }
+    }
+  }
+}
+
+FIntVector UHookableTargetSubsystem::GetCell(const FVector &Location) const {
+  return FIntVector(FMath::FloorToInt(Location.X / CellSize),
+                    FMath::FloorToInt(Location.Y / CellSize),
+                    FMath::FloorToInt(Location.Z / CellSize));
+}
+
+bool UHookableTargetSubsystem::HasIndexedTag(const AActor *Actor) const {
+  if (!Actor)
+    return false;
+
+  for (const FName &Tag : Actor->Tags) {
+    if (IndexedTags.Contains(Tag))
+      return true;
+  }
+  return false;
+}
+
+void UHookableTargetSubsystem::RemoveFromCell(AActor *Actor,
+                                              const FIntVector &Cell) {
+  if (TArray<TWeakObjectPtr<AActor>> *Bucket = Cells.Find(Cell)) {
+    Bucket->RemoveSingleSwap(Actor);
+    if (Bucket->Num() == 0) {
+      Cells.Remove(Cell);
+    }
+  }
+}
+
+void UHookableTargetSubsystem::HandleActorSpawned(AActor *Actor) {
+  if (HasIndexedTag(Actor)) {
+    RegisterTarget(Actor);
+  }
+}
+
+void UHookableTargetSubsystem::HandleLevelAdded(ULevel *Level,
+                                                UWorld *World) {
+  if (Level && World == GetWorld() && World->HasBegunPlay()) {
+    RegisterLevel(*Level);
+  }
+}
+
+void UHookableTargetSubsystem::HandleLevelRemoved(ULevel *Level,
+                                                  UWorld *World) {
+  // A null level means the whole world is going away (Deinitialize clears)
+  if (Level && World == GetWorld()) {
+    UnregisterLevel(*Level);
+  }
+}
+
+void UHookableTargetSubsystem::RegisterLevel(const ULevel &Level) {
+  for (AActor *Actor : Level.Actors) {
+    if (HasIndexedTag(Actor)) {
+      RegisterTarget(Actor);
+    }
+  }
+}
+
+void UHookableTargetSubsystem::UnregisterLevel(const ULevel &Level) {
+  for (AActor *Actor : Level.Actors) {
+    if (Actor &&
+        (CellByActor.Contains(Actor) || MovingTargets.Contains(Actor))) {
+      UnregisterTarget(Actor);
+    }
+  }
+}
+
+void UHookableTargetSubsystem::HandleActorEndPlay(
+    AActor *Actor, EEndPlayReason::Type EndPlayReason) {
+  UnregisterTarget(Actor);
+}
+
+// ===================================================================
+// QUERIES
+// ===================================================================
+
+void UHookableTargetSubsystem::QueryCone(const FVector &Origin,
+                                         const FVector &Direction,
+                                         float HalfAngleDeg, float Range,
+                                         FName RequiredTag,
+                                         TArray<AActor *> &OutActors) const {
+  SCOPE_CYCLE_COUNTER(STAT_HookableConeQuery);
+
+  OutActors.Reset();
+  if (Range <= 0.f)
+    return;
+
+  const float HalfAngleRad =
+      FMath::DegreesToRadians(FMath::Clamp(HalfAngleDeg, 0.f, 180.f));
+  const float CosHalf = FMath::Cos(HalfAngleRad);
+  const float RangeSq = FMath::Square(Range);
+
+  auto TestActor = [&](AActor *Actor) {
+    if (!IsValid(Actor))
+      return;
+    if (!RequiredTag.IsNone() && !Actor->ActorHasTag(RequiredTag))
+      return;
+
+    const FVector ToTarget = Actor->GetActorLocation() - Origin;
+    const float DistSq = ToTarget.SizeSquared();
+    if (DistSq > RangeSq)
+      return;
+
+    // Angle test without Acos: dot(D, T) >= cos(half) * |T|
+    if (FVector::DotProduct(Direction, ToTarget) <
+        CosHalf * FMath::Sqrt(DistSq))
+      return;
+
+    OutActors.Add(Actor);
+  };
+
+  for (const TWeakObjectPtr<AActor> &Target : MovingTargets) {
+    TestActor(Target.Get());
+  }
+
+  if (Cells.Num() == 0)
+    return;
+
+  // Bounding box of the spherical sector: apex, cap disc, and any axis
+  // extreme that falls inside the cone. Past 90 deg, use the whole sphere.
+  FBox Bounds(Origin - FVector(Range), Origin + FVector(Range));
+  if (HalfAngleDeg <= 90.f) {
+    const float SinHalf = FMath::Sin(HalfAngleRad);
+    const FVector CapCenter = Origin + Direction * (Range * CosHalf);
+    const float CapRadius = Range * SinHalf;
+    // Disc of radius r with normal D spans r * sqrt(1 - D_i^2) on axis i
+    auto DiscExtent = [CapRadius](double Component) {
+      return CapRadius *
+             FMath::Sqrt(FMath::Max(0.0, 1.0 - Component * Component));
+    };
+    const FVector CapExtent(DiscExtent(Direction.X), DiscExtent(Direction.Y),
+                            DiscExtent(Direction.Z));
+
+    Bounds = FBox(Origin, Origin);
+    Bounds += CapCenter - CapExtent;
+    Bounds += CapCenter + CapExtent;
+    for (int32 Axis = 0; Axis < 3; ++Axis) {
+      FVector AxisDir = FVector::ZeroVector;
+      AxisDir[Axis] = 1.f;
+      if (Direction[Axis] >= CosHalf)
+        Bounds += Origin + AxisDir * Range;
+      if (-Direction[Axis] >= CosHalf)
+        Bounds += Origin - AxisDir * Range;
+    }
+  }
+
+  const FIntVector MinCell = GetCell(Bounds.Min);
+  const FIntVector MaxCell = GetCell(Bounds.Max);
+  const int64 NumQueryCells = int64(MaxCell.X - MinCell.X + 1) *
+                              (MaxCell.Y - MinCell.Y + 1) *
+                              (MaxCell.Z - MinCell.Z + 1);
+
+  auto TestBucket = [&](const TArray<TWeakObjectPtr<AActor>> &Bucket) {
+    for (const TWeakObjectPtr<AActor> &Target : Bucket) {
+      TestActor(Target.Get());
+    }
+  };
+
+  // Sparse levels: walking the occupied cells is cheaper than probing
+  if (NumQueryCells > Cells.Num()) {
+    for (const auto &Pair : Cells) {
+      const FIntVector &Cell = Pair.Key;
+      if (Cell.X >= MinCell.X && Cell.X <= MaxCell.X &&
+          Cell.Y >= MinCell.Y && Cell.Y <= MaxCell.Y &&
+          Cell.Z >= MinCell.Z && Cell.Z <= MaxCell.Z) {
+        TestBucket(Pair.Value);
+      }
+    }
+    return;
+  }
+
+  for (int32 X = MinCell.X; X <= MaxCell.X; ++X) {
+    for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y) {
+      for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z) {
+        if (const TArray<TWeakObjectPtr<AActor>> *Bucket =
+                Cells.Find(FIntVector(X, Y, Z))) {
+          TestBucket(*Bucket);
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,108 @@
+// HookableTargetSubsystem.h
+// Spatial registry of hookable actors (magnetism / focus queries)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "HookableTargetSubsystem.generated.h"
+
+/**
+ * Registry of hookable actors, bucketed in a uniform spatial hash.
+ *
+ * Actors carrying one of the indexed tags join automatically when the world
+ * begins play, when their streamed level (or World Partition cell) is added
+ * to the world, or when they are spawned; they leave on EndPlay or when their
+ * level is removed. Movable actors
+ * are kept in a flat list (their cell would go stale) and tested on every
+ * query; everything else is only visited if its cell overlaps the query cone.
+ */
+UCLASS()
+class LINKMEPROJECT_API UHookableTargetSubsystem : public UWorldSubsystem {
+  GENERATED_BODY()
+
+public:
+  /** Tag indexed by default (matches UTPSAimingComponent::HookableTag) */
+  static const FName DefaultHookableTag;
+
+  virtual void Initialize(FSubsystemCollectionBase &Collection) override;
+  virtual void Deinitialize() override;
+  virtual void OnWorldBeginPlay(UWorld &InWorld) override;
+
+  // ===================================================================
+  // REGISTRATION
+  // ===================================================================
+
+  /** Add an actor explicitly (tag not required). No-op if already in. */
+  UFUNCTION(BlueprintCallable, Category = "Hookable")
+  void RegisterTarget(AActor *Actor);
+
+  UFUNCTION(BlueprintCallable, Category = "Hookable")
+  void UnregisterTarget(AActor *Actor);
+
+  /** Index every actor with this tag, now and when spawned later */
+  UFUNCTION(BlueprintCallable, Category = "Hookable")
+  void AddIndexedTag(FName Tag);
+
+  int32 GetNumTargets() const {
+    return CellByActor.Num() + MovingTargets.Num();
+  }
+
+  /** Movable targets (their cell would go stale, they are not hashed) */
+  const TArray<TWeakObjectPtr<AActor>> &GetMovingTargets() const {
+    return MovingTargets;
+  }
+
+  // ===================================================================
+  // QUERIES
+  // ===================================================================
+
+  /**
+   * Actors within Range of Origin and within HalfAngleDeg of Direction.
+   * Only hash cells overlapping the cone's bounding box are visited, and the
+   * angle test is a dot product against a precomputed cosine.
+   *
+   * @param Direction must be normalized
+   * @param RequiredTag if not None, actors without it are skipped
+   */
+  void QueryCone(const FVector &Origin, const FVector &Direction,
+                 float HalfAngleDeg, float Range, FName RequiredTag,
+                 TArray<AActor *> &OutActors) const;
+
+protected:
+  virtual bool DoesSupportWorldType(
+      const EWorldType::Type WorldType) const override;
+
+private:
+  /** Edge length of a hash cell (cm). A third of the default magnetism range
+   * keeps a query around a few dozen cells. */
+  static constexpr float CellSize = 1000.f;
+
+  FIntVector GetCell(const FVector &Location) const;
+  bool HasIndexedTag(const AActor *Actor) const;
+  void RemoveFromCell(AActor *Actor, const FIntVector &Cell);
+
+  void HandleActorSpawned(AActor *Actor);
+  void HandleLevelAdded(ULevel *Level, UWorld *World);
+  void HandleLevelRemoved(ULevel *Level, UWorld *World);
+
+  /** Register (or unregister) every tagged actor of a level */
+  void RegisterLevel(const ULevel &Level);
+  void UnregisterLevel(const ULevel &Level);
+
+  UFUNCTION()
+  void HandleActorEndPlay(AActor *Actor, EEndPlayReason::Type EndPlayReason);
+
+  /** Static / stationary targets */
+  TMap<FIntVector, TArray<TWeakObjectPtr<AActor>>> Cells;
+  TMap<TWeakObjectPtr<AActor>, FIntVector> CellByActor;
+
+  /** Movable targets: tested linearly, usually a handful */
+  TArray<TWeakObjectPtr<AActor>> MovingTargets;
+
+  TSet<FName> IndexedTags;
+
+  FDelegateHandle ActorSpawnedHandle;
+  FDelegateHandle LevelAddedHandle;
+  FDelegateHandle LevelRemovedHandle;
+};
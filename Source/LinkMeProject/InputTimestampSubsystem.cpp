@@ -0,0 +1,105 @@
+// InputTimestampSubsystem.cpp
+
+#include "InputTimestampSubsystem.h"
+#include "Engine/World.h"
+#include "Framework/Application/SlateApplication.h"
+#include "GameFramework/WorldSettings.h"
+#include "Misc/App.h"
+
+#if PLATFORM_WINDOWS
+#include "Windows/WindowsApplication.h"
+
+/** Observes input messages as they are dispatched, never consumes them */
+class FPressMessageHandler : public IWindowsMessageHandler {
+public:
+  explicit FPressMessageHandler(UInputTimestampSubsystem &InOwner)
+      : Owner(InOwner) {}
+
+  virtual bool ProcessMessage(HWND Hwnd, uint32 Message, WPARAM WParam,
+                              LPARAM LParam, int32 &OutResult) override {
+    // Bit 30: key was already down (auto-repeat, not a press)
+    const bool bKeyPress = (Message == WM_KEYDOWN ||
+                            Message == WM_SYSKEYDOWN) &&
+                           (LParam & (1 << 30)) == 0;
+    const bool bButtonPress =
+        Message == WM_LBUTTONDOWN || Message == WM_RBUTTONDOWN ||
+        Message == WM_MBUTTONDOWN || Message == WM_XBUTTONDOWN;
+
+    if (bKeyPress || bButtonPress) {
+      // Message time is on the GetTickCount clock (ms, wraps after ~49
+      // days: the unsigned difference stays right across the wrap)
+      const DWORD AgeMs =
+          ::GetTickCount() - static_cast<DWORD>(::GetMessageTime());
+      Owner.RecordPress(FPlatformTime::Seconds() - AgeMs / 1000.0);
+    }
+    return false;
+  }
+
+private:
+  UInputTimestampSubsystem &Owner;
+};
+#else
+class FPressMessageHandler {};
+#endif
+
+bool UInputTimestampSubsystem::ShouldCreateSubsystem(UObject *Outer) const {
+#if PLATFORM_WINDOWS
+  return Super::ShouldCreateSubsystem(Outer) && !IsRunningDedicatedServer() &&
+         FSlateApplication::IsInitialized();
+#else
+  return false;
+#endif
+}
+
+void UInputTimestampSubsystem::Initialize(
+    FSubsystemCollectionBase &Collection) {
+  Super::Initialize(Collection);
+
+#if PLATFORM_WINDOWS
+  const TSharedPtr<GenericApplication> PlatformApp =
+      FSlateApplication::Get().GetPlatformApplication();
+  if (PlatformApp.IsValid()) {
+    MessageHandler = MakeShared<FPressMessageHandler>(*this);
+    static_cast<FWindowsApplication *>(PlatformApp.Get())
+        ->AddMessageHandler(*MessageHandler);
+  }
+#endif
+}
+
+void UInputTimestampSubsystem::Deinitialize() {
+#if PLATFORM_WINDOWS
+  if (MessageHandler && FSlateApplication::IsInitialized()) {
+    const TSharedPtr<GenericApplication> PlatformApp =
+        FSlateApplication::Get().GetPlatformApplication();
+    if (PlatformApp.IsValid()) {
+      static_cast<FWindowsApplication *>(PlatformApp.Get())
+          ->RemoveMessageHandler(*MessageHandler);
+    }
+  }
+#endif
+  MessageHandler.Reset();
+  Super::Deinitialize();
+}
+
+void UInputTimestampSubsystem::RecordPress(double PlatformSeconds) {
+  LastPressPlatformTime = PlatformSeconds;
+  LastPressFrame = GFrameCounter;
+}
+
+double UInputTimestampSubsystem::GetPressWorldTime(const UWorld *World) const {
+  // Messages are pumped before the world ticks, in the same engine frame
+  if (!World || LastPressPlatformTime < 0.0 || LastPressFrame != GFrameCounter)
+    return -1.0;
+
+  // FApp's current time is the platform time this frame's world time
+  // stands for
+  const AWorldSettings *Settings = World->GetWorldSettings();
+  const double Dilation =
+      Settings ? Settings->GetEffectiveTimeDilation() : 1.0;
+  const double Since =
+      (FApp::GetCurrentTime() - LastPressPlatformTime) * Dilation;
+
+  // A message pumped this frame was sent during the last frame interval
+  return World->GetTimeSeconds() -
+         FMath::Clamp(Since, 0.0, double(World->GetDeltaSeconds()));
+}
@@ -0,0 +1,46 @@
+// InputTimestampSubsystem.h
+// Platform timestamps of button presses, for timing-graded input
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "InputTimestampSubsystem.generated.h"
+
+class FPressMessageHandler;
+
+/**
+ * Remembers when the last key / mouse button press happened according to
+ * the platform, not when the game thread got round to it.
+ *
+ * Input is pumped once per frame, so a handler alone only knows that the
+ * press came some time during the last frame. Windows stamps each input
+ * message (GetMessageTime, read while the message is dispatched), which
+ * pins the press to the millisecond. Other platforms and devices without
+ * messages (XInput pads) have no stamp: GetPressWorldTime reports none and
+ * callers fall back to their own estimate.
+ */
+UCLASS()
+class LINKMEPROJECT_API UInputTimestampSubsystem
+    : public UGameInstanceSubsystem {
+  GENERATED_BODY()
+
+public:
+  virtual bool ShouldCreateSubsystem(UObject *Outer) const override;
+  virtual void Initialize(FSubsystemCollectionBase &Collection) override;
+  virtual void Deinitialize() override;
+
+  /** World time of the last press pumped this frame, or a negative value if
+   * the platform stamped none */
+  double GetPressWorldTime(const UWorld *World) const;
+
+  /** Platform message hook: a press happened at PlatformSeconds
+   * (FPlatformTime clock) */
+  void RecordPress(double PlatformSeconds);
+
+private:
+  double LastPressPlatformTime = -1.0;
+  uint64 LastPressFrame = 0;
+
+  TSharedPtr<FPressMessageHandler> MessageHandler;
+};
@@ -3,4 +3,20 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Engine/World.h"
+#include "Stats/Stats.h"
 
+DECLARE_STATS_GROUP(TEXT("LinkMe"), STATGROUP_LinkMe, STATCAT_Advanced);
+
+namespace LinkMe {
+
+/**
+ * Cosmetic work (rope render sim, IK / head look traces, camera) has no
+ * consumer without a viewport. Components check this once at BeginPlay and
+ * disable their visual-only tick paths on a dedicated server.
+ */
+inline bool ShouldRunCosmetics(const UWorld *World) {
+  return World && World->GetNetMode() != NM_DedicatedServer;
+}
+
+} // namespace LinkMe
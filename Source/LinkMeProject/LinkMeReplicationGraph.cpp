@@ -0,0 +1,235 @@
+// LinkMeReplicationGraph.cpp
+
+#include "LinkMeReplicationGraph.h"
+#include "Engine/LevelBounds.h"
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+#include "ReplicationGraphTypes.h"
+#include "RopeHookActor.h"
+#include "UObject/UObjectIterator.h"
+
+namespace {
+
+bool IsSpatialized(ELinkMeClassRouting Routing) {
+  return Routing >= ELinkMeClassRouting::Spatialize_Static;
+}
+
+} // namespace
+
+// ===================================================================
+// CLASS SETTINGS
+// ===================================================================
+
+ELinkMeClassRouting ULinkMeReplicationGraph::GetRouting(UClass *Class) const {
+  if (const ELinkMeClassRouting *Routing = ClassRouting.Get(Class))
+    return *Routing;
+
+  const AActor *CDO = Class->GetDefaultObject<AActor>();
+  if (CDO->bOnlyRelevantToOwner) {
+    // Only the connection's own controller is expected here; it is gathered
+    // by the connection node
+    return ELinkMeClassRouting::NotRouted;
+  }
+  if (CDO->bAlwaysRelevant)
+    return ELinkMeClassRouting::RelevantAllConnections;
+  if (!CDO->IsRootComponentMovable())
+    return ELinkMeClassRouting::Spatialize_Static;
+  return CDO->NetDormancy > DORM_Awake
+             ? ELinkMeClassRouting::Spatialize_Dormancy
+             : ELinkMeClassRouting::Spatialize_Dynamic;
+}
+
+void ULinkMeReplicationGraph::InitClassReplicationInfo(
+    FClassReplicationInfo &Info, UClass *Class, bool bSpatialize) const {
+  const AActor *CDO = Class->GetDefaultObject<AActor>();
+  if (bSpatialize) {
+    Info.SetCullDistanceSquared(CDO->GetNetCullDistanceSquared());
+  }
+  Info.ReplicationPeriodFrame = GetReplicationPeriodFrameForFrequency(
+      FMath::Max(CDO->GetNetUpdateFrequency(), 1.f));
+}
+
+void ULinkMeReplicationGraph::InitGlobalActorClassSettings() {
+  Super::InitGlobalActorClassSettings();
+
+  // Hooks ride on their owner (see RouteAddNetworkActorToNodes)
+  ClassRouting.Set(ARopeHookActor::StaticClass(),
+                   ELinkMeClassRouting::NotRouted);
+  ClassRouting.Set(APlayerController::StaticClass(),
+                   ELinkMeClassRouting::NotRouted);
+  ClassRouting.Set(AGameStateBase::StaticClass(),
+                   ELinkMeClassRouting::RelevantAllConnections);
+  ClassRouting.Set(APlayerState::StaticClass(),
+                   ELinkMeClassRouting::RelevantAllConnections);
+  ClassRouting.Set(APawn::StaticClass(),
+                   ELinkMeClassRouting::Spatialize_Dynamic);
+
+  // Frequency and cull distance come from each class default object.
+  // Blueprint classes loaded later inherit their native parent's settings.
+  for (TObjectIterator<UClass> It; It; ++It) {
+    UClass *Class = *It;
+    const AActor *CDO = Cast<AActor>(Class->GetDefaultObject(false));
+    if (!CDO || !CDO->GetIsReplicated())
+      continue;
+
+    // Blueprint compile intermediates
+    const FString ClassName = Class->GetName();
+    if (ClassName.StartsWith(TEXT("SKEL_")) ||
+        ClassName.StartsWith(TEXT("REINST_")))
+      continue;
+
+    FClassReplicationInfo Info;
+    InitClassReplicationInfo(Info, Class, IsSpatialized(GetRouting(Class)));
+    GlobalActorReplicationInfoMap.SetClassInfo(Class, Info);
+  }
+}
+
+ULinkMeReplicationGraph *ULinkMeReplicationGraph::Get(const UWorld *World) {
+  const UNetDriver *NetDriver = World ? World->GetNetDriver() : nullptr;
+  return NetDriver ? Cast<ULinkMeReplicationGraph>(
+                         NetDriver->GetReplicationDriver())
+                   : nullptr;
+}
+
+void ULinkMeReplicationGraph::SetActorReplicationFrequency(AActor *Actor,
+                                                           float Frequency) {
+  // Not in the graph yet (or any more): its class rate applies on add
+  FGlobalActorReplicationInfo *Info = GlobalActorReplicationInfoMap.Find(Actor);
+  if (!Info)
+    return;
+
+  Info->Settings.ReplicationPeriodFrame =
+      Frequency > 0.f
+          ? GetReplicationPeriodFrameForFrequency(Frequency)
+          : GlobalActorReplicationInfoMap.GetClassInfo(Actor->GetClass())
+                .ReplicationPeriodFrame;
+}
+
+// ===================================================================
+// NODES
+// ===================================================================
+
+FVector2D
+ULinkMeReplicationGraph::ComputeSpatialBias(const UWorld *World) const {
+  const ULevel *Level = World ? World->PersistentLevel.Get() : nullptr;
+  const FBox Bounds =
+      Level ? ALevelBounds::CalculateLevelBounds(Level) : FBox(ForceInit);
+  if (!Bounds.IsValid)
+    return FVector2D(SpatialBiasX, SpatialBiasY);
+
+  // One cell of margin for actors that leave the level a little (falls,
+  // hooks thrown over the edge)
+  return FVector2D(Bounds.Min.X, Bounds.Min.Y) - FVector2D(GridCellSize);
+}
+
+void ULinkMeReplicationGraph::InitGlobalGraphNodes() {
+  GridNode = CreateNewNode<UReplicationGraphNode_GridSpatialization2D>();
+  GridNode->CellSize = GridCellSize;
+  GridNode->SpatialBias = FVector2D(SpatialBiasX, SpatialBiasY);
+
+  if (bDistanceFrequencyFalloff) {
+    // Moving actors of each cell are sorted into distance / view zones,
+    // each with its own replication period
+    GridNode->CreateCellNodeOverride =
+        [](UReplicationGraphNode_GridSpatialization2D *Parent) {
+          UReplicationGraphNode_GridCell *Cell =
+              Parent->CreateChildNode<UReplicationGraphNode_GridCell>();
+          Cell->CreateDynamicNodeOverride =
+              [](UReplicationGraphNode_GridCell *CellParent) {
+                return CellParent->CreateChildNode<
+                    UReplicationGraphNode_DynamicSpatialFrequency>();
+              };
+          return Cell;
+        };
+  }
+  AddGlobalGraphNode(GridNode);
+
+  AlwaysRelevantNode = CreateNewNode<UReplicationGraphNode_ActorList>();
+  AddGlobalGraphNode(AlwaysRelevantNode);
+}
+
+void ULinkMeReplicationGraph::InitializeActorsInWorld(UWorld *InWorld) {
+  // The graph is built before the net driver gets its world: place the grid
+  // once the level's actors can be measured, before any of them is binned
+  GridNode->SpatialBias = ComputeSpatialBias(InWorld);
+  Super::InitializeActorsInWorld(InWorld);
+}
+
+void ULinkMeReplicationGraph::InitConnectionGraphNodes(
+    UNetReplicationGraphConnection *ConnectionManager) {
+  Super::InitConnectionGraphNodes(ConnectionManager);
+
+  // The connection's controller and view target
+  AddConnectionGraphNode(
+      CreateNewNode<UReplicationGraphNode_AlwaysRelevant_ForConnection>(),
+      ConnectionManager);
+}
+
+// ===================================================================
+// ROUTING
+// ===================================================================
+
+void ULinkMeReplicationGraph::RouteAddNetworkActorToNodes(
+    const FNewReplicatedActorInfo &ActorInfo,
+    FGlobalActorReplicationInfo &GlobalInfo) {
+  // Hooks are spawned owned by their character: they replicate whenever it
+  // does, with no relevancy check of their own
+  if (ARopeHookActor *Hook = Cast<ARopeHookActor>(ActorInfo.Actor)) {
+    if (AActor *Owner = Hook->GetOwner()) {
+      GlobalActorReplicationInfoMap.AddDependentActor(Owner, Hook);
+    } else {
+      GridNode->AddActor_Dynamic(ActorInfo, GlobalInfo);
+    }
+    return;
+  }
+
+  switch (GetRouting(ActorInfo.Class)) {
+  case ELinkMeClassRouting::NotRouted:
+    break;
+  case ELinkMeClassRouting::RelevantAllConnections:
+    AlwaysRelevantNode->NotifyAddNetworkActor(ActorInfo);
+    break;
+  case ELinkMeClassRouting::Spatialize_Static:
+    GridNode->AddActor_Static(ActorInfo, GlobalInfo);
+    break;
+  case ELinkMeClassRouting::Spatialize_Dynamic:
+    GridNode->AddActor_Dynamic(ActorInfo, GlobalInfo);
+    break;
+  case ELinkMeClassRouting::Spatialize_Dormancy:
+    GridNode->AddActor_Dormancy(ActorInfo, GlobalInfo);
+    break;
+  }
+}
+
+void ULinkMeReplicationGraph::RouteRemoveNetworkActorToNodes(
+    const FNewReplicatedActorInfo &ActorInfo) {
+  if (ARopeHookActor *Hook = Cast<ARopeHookActor>(ActorInfo.Actor)) {
+    if (AActor *Owner = Hook->GetOwner()) {
+      GlobalActorReplicationInfoMap.RemoveDependentActor(Owner, Hook);
+    } else {
+      GridNode->RemoveActor_Dynamic(ActorInfo);
+    }
+    return;
+  }
+
+  switch (GetRouting(ActorInfo.Class)) {
+  case ELinkMeClassRouting::NotRouted:
+    break;
+  case ELinkMeClassRouting::RelevantAllConnections:
+    AlwaysRelevantNode->NotifyRemoveNetworkActor(ActorInfo);
+    break;
+  case ELinkMeClassRouting::Spatialize_Static:
+    GridNode->RemoveActor_Static(ActorInfo);
+    break;
+  case ELinkMeClassRouting::Spatialize_Dynamic:
+    GridNode->RemoveActor_Dynamic(ActorInfo);
+    break;
+  case ELinkMeClassRouting::Spatialize_Dormancy:
+    GridNode->RemoveActor_Dormancy(ActorInfo);
+    break;
+  }
+}
@@ -0,0 +1,102 @@
+// LinkMeReplicationGraph.h
+// Server relevancy policy: spatial grid for characters, hooks follow their
+// owner
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ReplicationGraph.h"
+#include "LinkMeReplicationGraph.generated.h"
+
+class UReplicationGraphNode_ActorList;
+class UReplicationGraphNode_GridSpatialization2D;
+
+/** How actors of a class enter the graph */
+enum class ELinkMeClassRouting : uint8 {
+  NotRouted,              // reached through another actor (or never sent)
+  RelevantAllConnections, // game state, player states
+  Spatialize_Static,      // never moves: binned into grid cells once
+  Spatialize_Dynamic,     // moves: re-binned every frame
+  Spatialize_Dormancy,    // static while dormant, dynamic when awake
+};
+
+/**
+ * Replaces the per-actor, per-connection relevancy checks of the default
+ * net driver.
+ *
+ * Characters (and any other moving actor) live in a 2D grid: a connection
+ * only gathers the cells around its viewer. Inside a cell, moving actors go
+ * through a distance / view based frequency node, so a far rope's topology
+ * and pendulum state update less often than a near one's.
+ *
+ * Replication rates belong to the graph: they come from the class defaults
+ * and, for moving actors, from the frequency zones. Changing an actor's
+ * NetUpdateFrequency at runtime has no effect; gameplay state that changes
+ * how often an actor needs updates (a rope swing, see
+ * URopeSystemComponent::SwingNetUpdateFrequency) goes through
+ * SetActorReplicationFrequency instead.
+ *
+ * Hooks are dependent actors of the character that fired them: they
+ * replicate whenever their owner does and are never gathered on their own.
+ *
+ * Enabled through ReplicationDriverClassName in DefaultEngine.ini.
+ */
+UCLASS(Transient, config = Engine)
+class LINKMEPROJECT_API ULinkMeReplicationGraph : public UReplicationGraph {
+  GENERATED_BODY()
+
+public:
+  virtual void InitGlobalActorClassSettings() override;
+  virtual void InitGlobalGraphNodes() override;
+  virtual void InitializeActorsInWorld(UWorld *InWorld) override;
+  virtual void InitConnectionGraphNodes(
+      UNetReplicationGraphConnection *ConnectionManager) override;
+  virtual void RouteAddNetworkActorToNodes(
+      const FNewReplicatedActorInfo &ActorInfo,
+      FGlobalActorReplicationInfo &GlobalInfo) override;
+  virtual void RouteRemoveNetworkActorToNodes(
+      const FNewReplicatedActorInfo &ActorInfo) override;
+
+  /** The server's graph (null on clients or with another driver) */
+  static ULinkMeReplicationGraph *Get(const UWorld *World);
+
+  /** Per-actor replication rate (Hz) in place of its class default.
+   * 0 restores the class rate. */
+  void SetActorReplicationFrequency(AActor *Actor, float Frequency);
+
+  /** Grid cell edge (cm). Smaller cells cull tighter but re-bin more. */
+  UPROPERTY(config)
+  float GridCellSize = 10000.f;
+
+  /**
+   * Grid origin (cm): actors below it on X or Y force the grid to rebuild.
+   * Taken from the loaded level's bounds, one cell of margin below their
+   * minimum corner; this configured corner only applies when the level has
+   * no bounds to read (empty or fully streamed persistent level). The
+   * default leaves 1.5 km / 2 km of negative coordinates.
+   */
+  UPROPERTY(config)
+  float SpatialBiasX = -150000.f;
+
+  UPROPERTY(config)
+  float SpatialBiasY = -200000.f;
+
+  /** Replicate far moving actors less often (per connection) */
+  UPROPERTY(config)
+  bool bDistanceFrequencyFalloff = true;
+
+private:
+  ELinkMeClassRouting GetRouting(UClass *Class) const;
+  FVector2D ComputeSpatialBias(const UWorld *World) const;
+  void InitClassReplicationInfo(FClassReplicationInfo &Info, UClass *Class,
+                                bool bSpatialize) const;
+
+  UPROPERTY()
+  TObjectPtr<UReplicationGraphNode_GridSpatialization2D> GridNode;
+
+  UPROPERTY()
+  TObjectPtr<UReplicationGraphNode_ActorList> AlwaysRelevantNode;
+
+  /** Explicit policies; other classes are routed from their CDO flags */
+  TClassMap<ELinkMeClassRouting> ClassRouting;
+};
@@ -0,0 +1,232 @@
+// LinkMeSignificanceManager.cpp
+
+#include "LinkMeSignificanceManager.h"
+#include "CharacterRope.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "LinkMeProject.h"
+
+DECLARE_STATS_GROUP(TEXT("LinkMe Significance"), STATGROUP_LinkMeSignificance,
+                    STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT(TEXT("Significance Update"), STAT_SignificanceUpdate,
+                   STATGROUP_LinkMeSignificance);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tier Local"), STAT_SignificanceLocal,
+                           STATGROUP_LinkMeSignificance);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tier Near"), STAT_SignificanceNear,
+                           STATGROUP_LinkMeSignificance);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tier Mid"), STAT_SignificanceMid,
+                           STATGROUP_LinkMeSignificance);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tier Far"), STAT_SignificanceFar,
+                           STATGROUP_LinkMeSignificance);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tier Hidden"), STAT_SignificanceHidden,
+                           STATGROUP_LinkMeSignificance);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Anim Evals / Frame"),
+                           STAT_SignificanceAnimEvals,
+                           STATGROUP_LinkMeSignificance);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Inertia Ticks / Frame"),
+                           STAT_SignificanceInertiaTicks,
+                           STATGROUP_LinkMeSignificance);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Limb IK On"), STAT_SignificanceLimbIK,
+                           STATGROUP_LinkMeSignificance);
+
+namespace {
+
+const FName CharacterTag(TEXT("Character"));
+
+constexpr int32 NumTiers = int32(EMonkeySignificance::Num);
+
+FMonkeySignificanceBudget MakeBudget(int32 AnimUpdateRate,
+                                     float InertiaTickInterval, bool bLimbIK,
+                                     float IKProbeInterval, int32 RopeSimLOD,
+                                     float RopeTickInterval) {
+  FMonkeySignificanceBudget Budget;
+  Budget.AnimUpdateRate = AnimUpdateRate;
+  Budget.InertiaTickInterval = InertiaTickInterval;
+  Budget.bLimbIK = bLimbIK;
+  Budget.IKProbeInterval = IKProbeInterval;
+  Budget.RopeSimLOD = RopeSimLOD;
+  Budget.RopeTickInterval = RopeTickInterval;
+  return Budget;
+}
+
+} // namespace
+
+ULinkMeSignificanceManager::ULinkMeSignificanceManager() {
+  // Local, Near, Mid, Far, Hidden
+  Budgets = {
+      MakeBudget(1, 0.f, true, 0.f, 0, 0.f),
+      MakeBudget(1, 0.f, true, 0.f, 0, 0.f),
+      MakeBudget(2, 1.f / 30.f, true, 0.1f, 1, 0.f),
+      MakeBudget(4, 1.f / 15.f, false, 0.f, 2, 1.f / 20.f),
+      MakeBudget(8, 0.25f, false, 0.f, 3, 0.25f),
+  };
+}
+
+ULinkMeSignificanceManager *
+ULinkMeSignificanceManager::Get(const UWorld *World) {
+  return World ? USignificanceManager::Get<ULinkMeSignificanceManager>(World)
+               : nullptr;
+}
+
+// ===================================================================
+// REGISTRATION
+// ===================================================================
+
+void ULinkMeSignificanceManager::RegisterCharacter(ACharacterRope *Character) {
+  // Start from the cheapest tier until the first score
+  Character->ApplySignificanceBudget(EMonkeySignificance::Hidden,
+                                     GetBudget(EMonkeySignificance::Hidden));
+
+  RegisterObject(
+      Character, CharacterTag,
+      [this](FManagedObjectInfo *ObjectInfo, const FTransform &Viewpoint) {
+        return CalculateSignificance(ObjectInfo, Viewpoint);
+      },
+      EPostSignificanceType::Sequential,
+      [this](FManagedObjectInfo *ObjectInfo, float OldSignificance,
+             float Significance, bool bFinal) {
+        if (bFinal)
+          return;
+
+        ACharacterRope *Target = Cast<ACharacterRope>(ObjectInfo->GetObject());
+        if (!Target)
+          return;
+
+        // Compare with the tier the character actually runs, not with
+        // OldSignificance: a new object starts at 1.0 (Far), so a character
+        // whose first score is Far would keep the Hidden budget above
+        const EMonkeySignificance NewTier = GetTier(Significance);
+        if (NewTier != Target->GetSignificanceTier()) {
+          Target->ApplySignificanceBudget(NewTier, GetBudget(NewTier));
+        }
+      });
+}
+
+void ULinkMeSignificanceManager::UnregisterCharacter(
+    ACharacterRope *Character) {
+  UnregisterObject(Character);
+}
+
+const FMonkeySignificanceBudget &
+ULinkMeSignificanceManager::GetBudget(EMonkeySignificance Tier) const {
+  static const FMonkeySignificanceBudget FullRate;
+  const int32 Index = int32(Tier);
+  return Budgets.IsValidIndex(Index) ? Budgets[Index] : FullRate;
+}
+
+// ===================================================================
+// SCORING
+// ===================================================================
+
+float ULinkMeSignificanceManager::CalculateSignificance(
+    const FManagedObjectInfo *ObjectInfo, const FTransform &Viewpoint) const {
+  const ACharacterRope *Character =
+      Cast<ACharacterRope>(ObjectInfo->GetObject());
+  if (!Character)
+    return 0.f;
+
+  const float Distance =
+      FVector::Dist(Viewpoint.GetLocation(), Character->GetActorLocation());
+
+  EMonkeySignificance Tier;
+  if (Character->IsLocallyControlled()) {
+    Tier = EMonkeySignificance::Local;
+  } else if (!Character->WasRecentlyRendered(HiddenTime)) {
+    Tier = EMonkeySignificance::Hidden;
+  } else if (Distance < NearDistance) {
+    Tier = EMonkeySignificance::Near;
+  } else if (Distance < MidDistance) {
+    Tier = EMonkeySignificance::Mid;
+  } else {
+    Tier = EMonkeySignificance::Far;
+  }
+
+  // Integer part: tier rank (Local highest). Fraction (0, 0.5]: closeness,
+  // keeps characters of a tier sorted by distance.
+  const float Closeness = 0.5f / (1.f + Distance / NearDistance);
+  return float(NumTiers - 1 - int32(Tier)) + Closeness;
+}
+
+EMonkeySignificance ULinkMeSignificanceManager::GetTier(float Significance) {
+  const int32 Rank =
+      FMath::Clamp(FMath::FloorToInt(Significance), 0, NumTiers - 1);
+  return EMonkeySignificance(NumTiers - 1 - Rank);
+}
+
+// ===================================================================
+// TICK
+// ===================================================================
+
+void ULinkMeSignificanceManager::Tick(float DeltaTime) {
+  SCOPE_CYCLE_COUNTER(STAT_SignificanceUpdate);
+
+  UWorld *World = GetWorld();
+
+  ViewTransforms.Reset();
+  for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator();
+       It; ++It) {
+    const APlayerController *PC = It->Get();
+    if (!PC || !PC->IsLocalController())
+      continue;
+
+    FVector ViewLocation;
+    FRotator ViewRotation;
+    PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+    ViewTransforms.Emplace(ViewRotation, ViewLocation);
+  }
+
+  Update(ViewTransforms);
+
+#if STATS
+  int32 TierCounts[NumTiers] = {};
+  float AnimEvals = 0.f;
+  float InertiaTicks = 0.f;
+  int32 LimbIK = 0;
+
+  for (const FManagedObjectInfo *Info : GetManagedObjects(CharacterTag)) {
+    const EMonkeySignificance Tier = GetTier(Info->GetSignificance());
+    const FMonkeySignificanceBudget &Budget = GetBudget(Tier);
+    ++TierCounts[int32(Tier)];
+    AnimEvals += 1.f / FMath::Max(Budget.AnimUpdateRate, 1);
+    InertiaTicks +=
+        Budget.InertiaTickInterval > DeltaTime
+            ? DeltaTime / Budget.InertiaTickInterval
+            : 1.f;
+    LimbIK += Budget.bLimbIK ? 1 : 0;
+  }
+
+  SET_DWORD_STAT(STAT_SignificanceLocal,
+                 TierCounts[int32(EMonkeySignificance::Local)]);
+  SET_DWORD_STAT(STAT_SignificanceNear,
+                 TierCounts[int32(EMonkeySignificance::Near)]);
+  SET_DWORD_STAT(STAT_SignificanceMid,
+                 TierCounts[int32(EMonkeySignificance::Mid)]);
+  SET_DWORD_STAT(STAT_SignificanceFar,
+                 TierCounts[int32(EMonkeySignificance::Far)]);
+  SET_DWORD_STAT(STAT_SignificanceHidden,
+                 TierCounts[int32(EMonkeySignificance::Hidden)]);
+  SET_FLOAT_STAT(STAT_SignificanceAnimEvals, AnimEvals);
+  SET_FLOAT_STAT(STAT_SignificanceInertiaTicks, InertiaTicks);
+  SET_DWORD_STAT(STAT_SignificanceLimbIK, LimbIK);
+#endif
+}
+
+TStatId ULinkMeSignificanceManager::GetStatId() const {
+  RETURN_QUICK_DECLARE_CYCLE_STAT(ULinkMeSignificanceManager,
+                                  STATGROUP_Tickables);
+}
+
+bool ULinkMeSignificanceManager::IsTickable() const {
+  const UWorld *World = GetWorld();
+  return World && World->IsGameWorld() && LinkMe::ShouldRunCosmetics(World);
+}
+
+ETickableTickType ULinkMeSignificanceManager::GetTickableTickType() const {
+  return HasAnyFlags(RF_ClassDefaultObject) ? ETickableTickType::Never
+                                            : ETickableTickType::Conditional;
+}
+
+UWorld *ULinkMeSignificanceManager::GetTickableGameObjectWorld() const {
+  return GetWorld();
+}
@@ -0,0 +1,77 @@
+// LinkMeSignificanceManager.h
+// Scores characters against the local views and hands out update budgets
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MonkeyTypes.h"
+#include "SignificanceManager.h"
+#include "Tickable.h"
+#include "LinkMeSignificanceManager.generated.h"
+
+class ACharacterRope;
+
+/**
+ * One place deciding how often each character's cosmetic systems run.
+ *
+ * Characters register at BeginPlay (clients and listen servers only). Every
+ * frame the manager scores them against the local players' views: locally
+ * controlled, then rendered characters by distance, then characters not
+ * rendered recently. The score picks an EMonkeySignificance tier. When a
+ * character changes tier, it gets that tier's FMonkeySignificanceBudget
+ * (ACharacterRope::ApplySignificanceBudget): anim update rate, inertia tick,
+ * limb IK probes, rope render LOD.
+ *
+ * "stat LinkMeSignificance" shows the tier populations and what they cost.
+ *
+ * Enabled through SignificanceManagerClassName in DefaultEngine.ini.
+ */
+UCLASS(config = Game)
+class LINKMEPROJECT_API ULinkMeSignificanceManager
+    : public USignificanceManager,
+      public FTickableGameObject {
+  GENERATED_BODY()
+
+public:
+  ULinkMeSignificanceManager();
+
+  static ULinkMeSignificanceManager *Get(const UWorld *World);
+
+  void RegisterCharacter(ACharacterRope *Character);
+  void UnregisterCharacter(ACharacterRope *Character);
+
+  const FMonkeySignificanceBudget &GetBudget(EMonkeySignificance Tier) const;
+
+  // FTickableGameObject interface
+  virtual void Tick(float DeltaTime) override;
+  virtual TStatId GetStatId() const override;
+  virtual bool IsTickable() const override;
+  virtual ETickableTickType GetTickableTickType() const override;
+  virtual UWorld *GetTickableGameObjectWorld() const override;
+
+  /** Rendered characters closer than this (cm) are Near */
+  UPROPERTY(config, EditAnywhere, Category = "Significance")
+  float NearDistance = 1500.f;
+
+  /** Rendered characters closer than this (cm) are Mid, further are Far */
+  UPROPERTY(config, EditAnywhere, Category = "Significance")
+  float MidDistance = 4000.f;
+
+  /** Not rendered for this long (s): Hidden */
+  UPROPERTY(config, EditAnywhere, Category = "Significance")
+  float HiddenTime = 0.5f;
+
+  /** Indexed by EMonkeySignificance */
+  UPROPERTY(config, EditAnywhere, Category = "Significance")
+  TArray<FMonkeySignificanceBudget> Budgets;
+
+private:
+  /** Tier rank + closeness within the tier, higher is more significant */
+  float CalculateSignificance(const FManagedObjectInfo *ObjectInfo,
+                              const FTransform &Viewpoint) const;
+
+  static EMonkeySignificance GetTier(float Significance);
+
+  /** Scratch view list, reused every frame */
+  TArray<FTransform> ViewTransforms;
+};
@@ -83,6 +83,56 @@ struct FProceduralAnimData {
   float LandingAlpha = 0.0f;
 };
 
+// ============================================================================
+// SIGNIFICANCE (per-character update budgets)
+// ============================================================================
+
+/** Significance tier, most significant first */
+UENUM(BlueprintType)
+enum class EMonkeySignificance : uint8 {
+  Local,  // Locally controlled
+  Near,   // Rendered, close to a view
+  Mid,    // Rendered, mid range
+  Far,    // Rendered, far away
+  Hidden, // Not rendered recently
+  Num UMETA(Hidden)
+};
+
+/** How often each per-character system runs in a significance tier */
+USTRUCT(BlueprintType)
+struct FMonkeySignificanceBudget {
+  GENERATED_BODY()
+
+  /** Evaluate the anim graph every N frames, interpolating in between */
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Significance",
+            meta = (ClampMin = "1"))
+  int32 AnimUpdateRate = 1;
+
+  /** Inertia spring tick interval (s, 0 = every frame) */
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Significance",
+            meta = (ClampMin = "0"))
+  float InertiaTickInterval = 0.f;
+
+  /** Limb IK on at all (feet / hands / pelvis) */
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Significance")
+  bool bLimbIK = true;
+
+  /** Shortest time between limb IK ground probes (s) */
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Significance",
+            meta = (ClampMin = "0"))
+  float IKProbeInterval = 0.f;
+
+  /** Rope render sim LOD: sub-steps and solver iterations halved per level */
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Significance",
+            meta = (ClampMin = "0"))
+  int32 RopeSimLOD = 0;
+
+  /** Rope render tick interval (s, 0 = every frame) */
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Significance",
+            meta = (ClampMin = "0"))
+  float RopeTickInterval = 0.f;
+};
+
 // ============================================================================
 // LEGACY (Deprecated - kept for compatibility during transition)
 // ============================================================================
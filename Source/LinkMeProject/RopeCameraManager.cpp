@@ -4,7 +4,12 @@
 #include "RopeCameraManager.h"
 #include "Components/CapsuleComponent.h"
 #include "Curves/CurveFloat.h"
+#include "Engine/World.h"
 #include "GameFramework/Character.h"
+#include "LinkMeProject.h"
+
+DECLARE_CYCLE_STAT(TEXT("Camera Manager Tick"), STAT_RopeCameraTick,
+                   STATGROUP_LinkMe);
 
 URopeCameraManager::URopeCameraManager() {
   PrimaryComponentTick.bCanEverTick = true;
@@ -19,6 +24,22 @@ void URopeCameraManager::BeginPlay() {
   if (!ensure(Owner))
     return;
 
+  // Dedicated server: no viewport, so no camera rig. Components placed in
+  // the Blueprint are pulled out of the scene; none are created.
+  bRunCosmetics = LinkMe::ShouldRunCosmetics(GetWorld());
+  if (!bRunCosmetics) {
+    SetComponentTickEnabled(false);
+    if (USpringArmComponent *ExistingArm =
+            Owner->FindComponentByClass<USpringArmComponent>()) {
+      ExistingArm->UnregisterComponent();
+    }
+    if (UCameraComponent *ExistingCamera =
+            Owner->FindComponentByClass<UCameraComponent>()) {
+      ExistingCamera->UnregisterComponent();
+    }
+    return;
+  }
+
   // Find or create SpringArm
   SpringArm = Owner->FindComponentByClass<USpringArmComponent>();
   if (!SpringArm) {
@@ -70,6 +91,7 @@ void URopeCameraManager::TickComponent(
     float DeltaTime, ELevelTick TickType,
     FActorComponentTickFunction *ThisTickFunction) {
   Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+  SCOPE_CYCLE_COUNTER(STAT_RopeCameraTick);
 
   // Check for Hybrid Logic Switch
   if (bUseBlueprintCameraLogic) {
@@ -147,6 +169,9 @@ void URopeCameraManager::ToggleShoulderSwap() {
 }
 
 void URopeCameraManager::AddEffect(const FCameraEffectLayer &Effect) {
+  // Layers that expired while the tick was off would otherwise pile up
+  RemoveExpiredEffects();
+
   // Check if layer already exists
   for (FCameraEffectLayer &Layer : ActiveLayers) {
     if (Layer.LayerID == Effect.LayerID) {
@@ -168,7 +193,7 @@ void URopeCameraManager::RemoveEffect(FName LayerID) {
 
 bool URopeCameraManager::HasEffect(FName LayerID) const {
   for (const FCameraEffectLayer &Layer : ActiveLayers) {
-    if (Layer.LayerID == LayerID) {
+    if (Layer.LayerID == LayerID && !IsExpired(Layer)) {
       return true;
     }
   }
@@ -178,6 +203,9 @@ bool URopeCameraManager::HasEffect(FName LayerID) const {
 void URopeCameraManager::ApplyTransientEffect(FName LayerID, float FOVDelta,
                                               FVector PositionOffset,
                                               float Duration) {
+  if (!bRunCosmetics)
+    return;
+
   FCameraEffectLayer Effect;
   Effect.LayerID = LayerID;
   Effect.FOVDelta = FOVDelta;
@@ -185,13 +213,11 @@ void URopeCameraManager::ApplyTransientEffect(FName LayerID, float FOVDelta,
   Effect.BlendWeight = 1.f;
   Effect.BlendSpeed = 20.f; // Fast blend-in
 
-  AddEffect(Effect);
+  // Expires on world time: no timer (and its delegate) per effect
+  Effect.ExpireTime = GetWorld()->GetTimeSeconds() +
+                      FMath::Max(Duration, UE_KINDA_SMALL_NUMBER);
 
-  // Timer to remove effect
-  FTimerHandle TimerHandle;
-  GetWorld()->GetTimerManager().SetTimer(
-      TimerHandle, [this, LayerID]() { RemoveEffect(LayerID); }, Duration,
-      false);
+  AddEffect(Effect);
 }
 
 void URopeCameraManager::UpdateCamera(float DeltaTime) {
@@ -260,6 +286,8 @@ void URopeCameraManager::ApplyEffectLayers(float DeltaTime) {
   if (!SpringArm || !Camera)
     return;
 
+  RemoveExpiredEffects();
+
   // Calculate totals from all active layers
   float TotalFOVDelta = 0.f;
   FVector TotalPositionOffset = FVector::ZeroVector;
@@ -369,10 +397,19 @@ FVector URopeCameraManager::GetCurrentSocketOffset() const {
   return CurrentSocketOffset;
 }
 
+int32 URopeCameraManager::GetActiveLayerCount() const {
+  int32 Count = 0;
+  for (const FCameraEffectLayer &Layer : ActiveLayers) {
+    Count += IsExpired(Layer) ? 0 : 1;
+  }
+  return Count;
+}
+
 TArray<FName> URopeCameraManager::GetActiveLayerIDs() const {
   TArray<FName> IDs;
   for (const FCameraEffectLayer &Layer : ActiveLayers) {
-    IDs.Add(Layer.LayerID);
+    if (!IsExpired(Layer))
+      IDs.Add(Layer.LayerID);
   }
   return IDs;
 }
@@ -380,11 +417,26 @@ TArray<FName> URopeCameraManager::GetActiveLayerIDs() const {
 float URopeCameraManager::GetTotalFOVDelta() const {
   float Total = 0.f;
   for (const FCameraEffectLayer &Layer : ActiveLayers) {
-    Total += Layer.FOVDelta * Layer.CurrentBlendAlpha;
+    if (!IsExpired(Layer))
+      Total += Layer.FOVDelta * Layer.CurrentBlendAlpha;
   }
   return Total;
 }
 
+bool URopeCameraManager::IsExpired(const FCameraEffectLayer &Layer) const {
+  const UWorld *World = GetWorld();
+  return Layer.ExpireTime > 0.0 && World &&
+         World->GetTimeSeconds() >= Layer.ExpireTime;
+}
+
+void URopeCameraManager::RemoveExpiredEffects() {
+  for (int32 i = ActiveLayers.Num() - 1; i >= 0; --i) {
+    if (IsExpired(ActiveLayers[i])) {
+      ActiveLayers.RemoveAt(i, 1, EAllowShrinking::No);
+    }
+  }
+}
+
 FString URopeCameraManager::GetStateAsString() const {
   switch (CurrentState) {
   case ECameraState::Grounded:
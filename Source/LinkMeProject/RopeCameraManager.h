@@ -51,6 +51,10 @@ struct FCameraEffectLayer {
   /** Current blend alpha (internal use) */
   float CurrentBlendAlpha = 0.f;
 
+  /** World time at which the layer removes itself, 0 = until removed
+   * (internal use, see ApplyTransientEffect) */
+  double ExpireTime = 0.0;
+
   /** Blend speed for FInterpTo */
   UPROPERTY(EditAnywhere, BlueprintReadWrite)
   float BlendSpeed = 10.f;
@@ -266,7 +270,7 @@ public:
 
   /** Get number of active effect layers */
   UFUNCTION(BlueprintPure, Category = "Camera|Debug")
-  int32 GetActiveLayerCount() const { return ActiveLayers.Num(); }
+  int32 GetActiveLayerCount() const;
 
   /** Get list of active layer IDs */
   UFUNCTION(BlueprintPure, Category = "Camera|Debug")
@@ -315,12 +319,22 @@ public:
   void OnBlueprintUpdateCamera(float DeltaTime);
 
 protected:
+  /** False on a dedicated server: no tick, no spring arm / camera */
+  bool bRunCosmetics = true;
+
   /** Update camera based on current state and effects */
   void UpdateCamera(float DeltaTime);
 
   /** Apply effect layers to camera */
   void ApplyEffectLayers(float DeltaTime);
 
+  /** Transient layer past its world expiry time. Checked wherever layers are
+   * read, since the component does not tick outside the Local tier. */
+  bool IsExpired(const FCameraEffectLayer &Layer) const;
+
+  /** Drop the expired transient layers */
+  void RemoveExpiredEffects();
+
   /** Clamp pitch input */
   void ClampPitch();
 
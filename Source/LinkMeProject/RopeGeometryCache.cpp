@@ -0,0 +1,68 @@
+// RopeGeometryCache.cpp
+
+#include "RopeGeometryCache.h"
+#include "Algo/BinarySearch.h"
+
+void FRopeGeometryCache::Rebuild(TConstArrayView<FVector> Points,
+                                 int32 NumFixed) {
+  RefreshFrom(Points, NumFixed, 0);
+}
+
+void FRopeGeometryCache::RefreshFrom(TConstArrayView<FVector> Points,
+                                     int32 NumFixed, int32 FirstDirty) {
+  NumFixed = FMath::Clamp(NumFixed, 0, Points.Num());
+  FirstDirty =
+      FMath::Clamp(FirstDirty, 0, FMath::Min(FixedPoints.Num(), NumFixed));
+
+  // Keep the allocation: ropes grow and shrink by a point or two per wrap
+  FixedPoints.SetNum(NumFixed, EAllowShrinking::No);
+  PrefixLengths.SetNum(NumFixed, EAllowShrinking::No);
+
+  for (int32 i = FirstDirty; i < NumFixed; ++i) {
+    FixedPoints[i] = Points[i];
+    PrefixLengths[i] =
+        (i == 0) ? 0.f
+                 : PrefixLengths[i - 1] +
+                       FVector::Dist(FixedPoints[i - 1], FixedPoints[i]);
+  }
+}
+
+void FRopeGeometryCache::Reset() {
+  FixedPoints.Reset();
+  PrefixLengths.Reset();
+  WrappedLength = 0.f;
+}
+
+float FRopeGeometryCache::GetPolylineLength(const FVector &FreeEnd) const {
+  if (FixedPoints.Num() == 0)
+    return 0.f;
+  return GetFixedLength() + FVector::Dist(FixedPoints.Last(), FreeEnd);
+}
+
+FVector FRopeGeometryCache::GetPointAtDistance(float Distance,
+                                               const FVector &FreeEnd) const {
+  if (FixedPoints.Num() == 0)
+    return FreeEnd;
+  if (Distance <= 0.f)
+    return FixedPoints[0];
+
+  // Free span (last fixed point -> free end)
+  const float FixedLength = GetFixedLength();
+  if (Distance >= FixedLength) {
+    const float FreeLength = FVector::Dist(FixedPoints.Last(), FreeEnd);
+    const float Alpha = FreeLength > KINDA_SMALL_NUMBER
+                            ? (Distance - FixedLength) / FreeLength
+                            : 1.f;
+    return FMath::Lerp(FixedPoints.Last(), FreeEnd,
+                       FMath::Clamp(Alpha, 0.f, 1.f));
+  }
+
+  // 0 <= Distance < FixedLength, so Upper is in [1, Num - 1]
+  const int32 Upper = Algo::UpperBound(PrefixLengths, Distance);
+  const int32 Lower = Upper - 1;
+  const float SpanLength = PrefixLengths[Upper] - PrefixLengths[Lower];
+  const float Alpha = SpanLength > KINDA_SMALL_NUMBER
+                          ? (Distance - PrefixLengths[Lower]) / SpanLength
+                          : 0.f;
+  return FMath::Lerp(FixedPoints[Lower], FixedPoints[Upper], Alpha);
+}
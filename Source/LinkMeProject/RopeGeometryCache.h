@@ -0,0 +1,69 @@
+// RopeGeometryCache.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Prefix-summed lengths of the fixed part of a rope polyline.
+ *
+ * Fixed points (anchor + bend points) only change on wrap/unwrap. The free
+ * end (player or hook) moves every tick, so it is passed at query time and
+ * never stored. Editing point i only recomputes the tail from i, so the usual
+ * wrap (append before the player) is O(1).
+ */
+struct LINKMEPROJECT_API FRopeGeometryCache {
+  /** Rebuild from Points[0..NumFixed-1]. O(n). */
+  void Rebuild(TConstArrayView<FVector> Points, int32 NumFixed);
+
+  /** Points[FirstDirty..] changed (insert, remove or move).
+   * O(NumFixed - FirstDirty). */
+  void RefreshFrom(TConstArrayView<FVector> Points, int32 NumFixed,
+                   int32 FirstDirty);
+
+  void Reset();
+
+  /** Rope wound around corners that is not part of the polyline */
+  void SetWrappedLength(float InWrappedLength) {
+    WrappedLength = InWrappedLength;
+  }
+
+  int32 NumFixed() const { return FixedPoints.Num(); }
+  const TArray<FVector> &GetFixedPoints() const { return FixedPoints; }
+
+  /** Last fixed point (pendulum pivot), or FreeEnd if there is none. */
+  FVector GetLastFixedPoint(const FVector &FreeEnd) const {
+    return FixedPoints.Num() > 0 ? FixedPoints.Last() : FreeEnd;
+  }
+
+  /** Length of [FixedPoints[0] .. FixedPoints.Last()]. O(1). */
+  float GetFixedLength() const {
+    return PrefixLengths.Num() > 0 ? PrefixLengths.Last() : 0.f;
+  }
+
+  float GetWrappedLength() const { return WrappedLength; }
+
+  SIZE_T GetAllocatedSize() const {
+    return FixedPoints.GetAllocatedSize() + PrefixLengths.GetAllocatedSize();
+  }
+
+  /** Polyline length including the free span to FreeEnd. O(1). */
+  float GetPolylineLength(const FVector &FreeEnd) const;
+
+  /** Polyline + wound rope - what the physics constraint works on. O(1). */
+  float GetTotalLength(const FVector &FreeEnd) const {
+    return GetPolylineLength(FreeEnd) + WrappedLength;
+  }
+
+  /** Point at arc length Distance along [fixed..., FreeEnd]. O(log n). */
+  FVector GetPointAtDistance(float Distance, const FVector &FreeEnd) const;
+
+private:
+  TArray<FVector> FixedPoints;
+
+  /** PrefixLengths[i] = polyline length from FixedPoints[0] to FixedPoints[i]
+   */
+  TArray<float> PrefixLengths;
+
+  float WrappedLength = 0.f;
+};
@@ -6,21 +6,41 @@
 #include "Components/StaticMeshComponent.h"
 #include "GameFramework/Actor.h"
 #include "GameFramework/Character.h" // Added missing include
+#include "GameFramework/GameStateBase.h"
+#include "HookFlightSubsystem.h"
+#include "LinkMeProject.h"
+#include "Net/UnrealNetwork.h"
 #include "PhysicsEngine/BodyInstance.h"
+#include "RopeRewindSubsystem.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Hook Flight Sweeps"), STAT_HookFlightSweeps,
+                           STATGROUP_LinkMe);
+
+namespace {
+double GetServerTime(const UWorld *World) {
+  if (const AGameStateBase *GameState = World->GetGameState()) {
+    return GameState->GetServerWorldTimeSeconds();
+  }
+  return World->GetTimeSeconds();
+}
+} // namespace
 
 ARopeHookActor::ARopeHookActor() {
-  PrimaryActorTick.bCanEverTick = true;
+  // Flight is stepped by UHookFlightSubsystem, nothing to tick here
+  PrimaryActorTick.bCanEverTick = false;
+
+  // Clients simulate the arc from LaunchRecord: no movement replication
+  bReplicates = true;
+  SetReplicateMovement(false);
 
   // Collision
   USphereComponent *Sphere =
       CreateDefaultSubobject<USphereComponent>(TEXT("HookCollision"));
   Sphere->InitSphereRadius(12.f);
   // REMOVED: Sphere->SetSimulatePhysics(true);
-  // REMOVED: Sphere->SetNotifyRigidBodyCollision(true); // Handled by
-  // Projectile
+  // Impacts come from the flight sweeps (see TickFlight)
   Sphere->SetCollisionProfileName(
       TEXT("BlockAllDynamic")); // Changed from PhysicsActor
-  Sphere->OnComponentHit.AddDynamic(this, &ARopeHookActor::HandleHookImpact);
   CollisionComponent = Sphere;
   RootComponent = Sphere;
 
@@ -28,34 +48,21 @@ ARopeHookActor::ARopeHookActor() {
   HookMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("HookMesh"));
   HookMesh->SetupAttachment(CollisionComponent);
   HookMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+}
+
+void ARopeHookActor::GetLifetimeReplicatedProps(
+    TArray<FLifetimeProperty> &OutLifetimeProps) const {
+  Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-  // Movement (PROJECTILE SYSTEM)
-  ProjectileMovement = CreateDefaultSubobject<UProjectileMovementComponent>(
-      TEXT("ProjectileMovement"));
-  ProjectileMovement->UpdatedComponent = CollisionComponent;
-  ProjectileMovement->InitialSpeed = LaunchImpulse; // 3500.f
-  ProjectileMovement->MaxSpeed = LaunchImpulse;
-  ProjectileMovement->bRotationFollowsVelocity = true;
-  ProjectileMovement->bSweepCollision = true; // ANTI-TUNNELING FIX
-  ProjectileMovement->ProjectileGravityScale = 1.0f;
-  ProjectileMovement->bShouldBounce = false;
+  DOREPLIFETIME(ARopeHookActor, LaunchRecord);
+  DOREPLIFETIME(ARopeHookActor, ImpactRecord);
 }
 
 void ARopeHookActor::BeginPlay() {
   Super::BeginPlay();
 
-  // Ignore collision with owner and any pawn initially (Safe Launch)
-  if (CollisionComponent) {
-    CollisionComponent->SetCollisionResponseToChannel(ECC_Pawn, ECR_Ignore);
-
-    // Re-enable after 0.2s
-    float SafeLaunchDelay = 0.2f;
-    GetWorld()->GetTimerManager().SetTimer(
-        SafeLaunchTimerHandle, this, &ARopeHookActor::ReEnablePawnCollision,
-        SafeLaunchDelay, false);
-  }
-
   // Ignore collision with owner to prevent immediate self-hit
+  // (other pawns are ignored for SafeLaunchTime, see StartFlight)
   if (GetOwner()) {
     // 1. Primitive Component Ignore
     if (CollisionComponent) {
@@ -73,44 +80,164 @@ void ARopeHookActor::BeginPlay() {
   }
 }
 
-void ARopeHookActor::ReEnablePawnCollision() {
-  if (CollisionComponent) {
-    CollisionComponent->SetCollisionResponseToChannel(ECC_Pawn, ECR_Block);
-
-    // If needed, keep ignoring specific owner
-    if (GetOwner()) {
-      CollisionComponent->IgnoreActorWhenMoving(GetOwner(), true);
-    }
-  }
+void ARopeHookActor::EndPlay(const EEndPlayReason::Type EndPlayReason) {
+  StopFlight();
+  Super::EndPlay(EndPlayReason);
 }
 
-void ARopeHookActor::Tick(float DeltaTime) { Super::Tick(DeltaTime); }
-
 void ARopeHookActor::Fire(const FVector &Direction) {
   UE_LOG(LogTemp, Warning, TEXT("Hook Fire called with Direction: %s"),
          *Direction.ToString());
-  if (ProjectileMovement) {
-    ProjectileMovement->Velocity = Direction * ProjectileMovement->InitialSpeed;
-    ProjectileMovement->Activate();
-    UE_LOG(LogTemp, Warning, TEXT("Projectile Activated with Speed: %f"),
-           ProjectileMovement->InitialSpeed);
-  }
+  StartFlight(Direction * LaunchImpulse);
+  UE_LOG(LogTemp, Warning, TEXT("Hook flight started with Speed: %f"),
+         LaunchImpulse);
 }
 
 void ARopeHookActor::FireVelocity(const FVector &Velocity) {
   UE_LOG(LogTemp, Warning, TEXT("Hook FireVelocity called: %s"),
          *Velocity.ToString());
-  if (ProjectileMovement) {
-    ProjectileMovement->Velocity = Velocity;
-    ProjectileMovement->Activate();
+  StartFlight(Velocity);
+}
+
+// ===================================================================
+// FLIGHT
+// ===================================================================
+
+void ARopeHookActor::StartFlight(const FVector &Velocity) {
+  if (bImpacted || !CollisionComponent)
+    return;
+
+  FlightVelocity = (MaxSpeed > 0.f) ? Velocity.GetClampedToMaxSize(MaxSpeed)
+                                    : Velocity;
+  FlightTime = 0.f;
+
+  // Same filtering a swept MoveComponent would apply
+  FlightQueryParams = FCollisionQueryParams(SCENE_QUERY_STAT(HookFlight),
+                                            false, this);
+  for (AActor *Ignored : CollisionComponent->GetMoveIgnoreActors()) {
+    FlightQueryParams.AddIgnoredActor(Ignored);
+  }
+  for (UPrimitiveComponent *Ignored :
+       CollisionComponent->GetMoveIgnoreComponents()) {
+    FlightQueryParams.AddIgnoredComponent(Ignored);
+  }
+
+  FlightResponseParams = FCollisionResponseParams(
+      CollisionComponent->GetCollisionResponseToChannels());
+  SafeLaunchResponseParams = FlightResponseParams;
+  SafeLaunchResponseParams.CollisionResponse.SetResponse(ECC_Pawn, ECR_Ignore);
+
+  if (!bFlying) {
+    bFlying = true;
+    if (UHookFlightSubsystem *Flight =
+            GetWorld()->GetSubsystem<UHookFlightSubsystem>()) {
+      Flight->RegisterHook(this);
+    }
+  }
+
+  if (HasAuthority()) {
+    LaunchRecord.Origin = GetActorLocation();
+    LaunchRecord.Velocity = FlightVelocity;
+    LaunchRecord.ServerLaunchTime = GetServerTime(GetWorld());
+    ForceNetUpdate();
   }
 }
 
-void ARopeHookActor::HandleHookImpact(UPrimitiveComponent *HitComp,
-                                      AActor *OtherActor,
-                                      UPrimitiveComponent *OtherComp,
-                                      FVector NormalImpulse,
-                                      const FHitResult &Hit) {
+void ARopeHookActor::FastForwardFlight(float Time) {
+  // Same fixed chunks as a 30 Hz tick, so substeps stay bounded
+  constexpr float Chunk = 1.f / 30.f;
+  while (bFlying && Time > KINDA_SMALL_NUMBER) {
+    const float Step = FMath::Min(Time, Chunk);
+    TickFlight(Step);
+    Time -= Step;
+  }
+}
+
+void ARopeHookActor::StopFlight() {
+  if (!bFlying)
+    return;
+
+  bFlying = false;
+  FlightVelocity = FVector::ZeroVector;
+
+  if (UWorld *World = GetWorld()) {
+    if (UHookFlightSubsystem *Flight =
+            World->GetSubsystem<UHookFlightSubsystem>()) {
+      Flight->UnregisterHook(this);
+    }
+  }
+}
+
+void ARopeHookActor::TickFlight(float DeltaTime) {
+  if (!bFlying || !CollisionComponent)
+    return;
+
+  UWorld *World = GetWorld();
+  const FVector Gravity(0.0, 0.0, World->GetGravityZ() * GravityScale);
+  const FCollisionShape Shape = CollisionComponent->GetCollisionShape();
+  const ECollisionChannel Channel =
+      CollisionComponent->GetCollisionObjectType();
+
+  // Substeps bound the chord-to-parabola error, not tunnelling: consecutive
+  // sweeps always cover the whole path
+  const float FrameDistance =
+      (FlightVelocity.Size() + 0.5f * Gravity.Size() * DeltaTime) * DeltaTime;
+  const int32 NumSubsteps = FMath::Clamp(
+      FMath::CeilToInt(FrameDistance / MaxSubstepDistance), 1, MaxSubsteps);
+  const float Step = DeltaTime / NumSubsteps;
+
+  // Lag compensation (server only): sweep against moving targets as the
+  // shooter saw them
+  const URopeRewindSubsystem *Rewind =
+      (RewindLatency > 0.f && HasAuthority())
+          ? World->GetSubsystem<URopeRewindSubsystem>()
+          : nullptr;
+  const double RewindTime = World->GetTimeSeconds() - RewindLatency;
+
+  FVector Location = GetActorLocation();
+  for (int32 i = 0; i < NumSubsteps; ++i) {
+    // Exact for constant gravity: p + v h + g h^2 / 2
+    const FVector Target =
+        Location + FlightVelocity * Step + Gravity * (0.5f * Step * Step);
+    const FCollisionResponseParams &Responses =
+        (FlightTime < SafeLaunchTime) ? SafeLaunchResponseParams
+                                      : FlightResponseParams;
+
+    FHitResult Hit;
+    const bool bBlocked =
+        Rewind ? Rewind->SweepAt(RewindTime, Hit, Location, Target, Channel,
+                                 Shape, FlightQueryParams, Responses, this)
+               : World->SweepSingleByChannel(Hit, Location, Target,
+                                             FQuat::Identity, Channel, Shape,
+                                             FlightQueryParams, Responses);
+    INC_DWORD_STAT(STAT_HookFlightSweeps);
+
+    if (bBlocked) {
+      SetActorLocationAndRotation(Hit.Location, FlightVelocity.Rotation());
+      // Clients only predict the stop; the server's impact record decides
+      if (HasAuthority()) {
+        HandleHookImpact(Hit);
+      } else {
+        StopFlight();
+      }
+      return;
+    }
+
+    Location = Target;
+    FlightVelocity += Gravity * Step;
+    if (MaxSpeed > 0.f) {
+      FlightVelocity = FlightVelocity.GetClampedToMaxSize(MaxSpeed);
+    }
+    FlightTime += Step;
+  }
+
+  // Rotation follows velocity
+  SetActorLocationAndRotation(Location, FlightVelocity.Rotation());
+}
+
+void ARopeHookActor::HandleHookImpact(const FHitResult &Hit) {
+  AActor *OtherActor = Hit.GetActor();
+  UPrimitiveComponent *OtherComp = Hit.GetComponent();
   UE_LOG(LogTemp, Warning,
          TEXT("HandleHookImpact called! Hit actor: %s, Hit component: %s"),
          OtherActor ? *OtherActor->GetName() : TEXT("NULL"),
@@ -132,13 +259,14 @@ void ARopeHookActor::HandleHookImpact(UPrimitiveComponent *HitComp,
   bImpacted = true;
   ImpactResult = Hit;
 
-  // Stop projectile
-  if (ProjectileMovement) {
-    ProjectileMovement->StopMovementImmediately();
-    ProjectileMovement->SetComponentTickEnabled(false);
-    UE_LOG(LogTemp, Warning, TEXT("Projectile movement stopped on hook."));
+  if (HasAuthority()) {
+    RecordImpact(Hit.ImpactPoint, Hit.ImpactNormal, Hit.GetComponent());
   }
 
+  // Stop flight
+  StopFlight();
+  UE_LOG(LogTemp, Warning, TEXT("Flight stopped on hook."));
+
   // Attach to hit object (only if it's not us!)
   if (Hit.Component.IsValid() && Hit.Component.Get() != CollisionComponent) {
     AttachToComponent(Hit.Component.Get(),
@@ -160,6 +288,71 @@ void ARopeHookActor::HandleHookImpact(UPrimitiveComponent *HitComp,
   }
 }
 
+void ARopeHookActor::LandAt(const FVector &Location,
+                            UPrimitiveComponent *Component) {
+  StopFlight();
+  SetActorLocation(Location);
+
+  if (HasAuthority()) {
+    RecordImpact(Location, FVector::UpVector, Component);
+  }
+}
+
+// ===================================================================
+// REPLICATION
+// ===================================================================
+
+void ARopeHookActor::RecordImpact(const FVector &ImpactPoint,
+                                  const FVector &ImpactNormal,
+                                  UPrimitiveComponent *Component) {
+  ImpactRecord.bValid = true;
+  ImpactRecord.Location = GetActorLocation();
+  ImpactRecord.ImpactPoint = ImpactPoint;
+  ImpactRecord.ImpactNormal = ImpactNormal;
+  // Only net-addressable components can be resolved on clients
+  ImpactRecord.Component =
+      (Component && Component->IsSupportedForNetworking()) ? Component
+                                                           : nullptr;
+  ForceNetUpdate();
+}
+
+void ARopeHookActor::OnRep_LaunchRecord() {
+  // Joined late or both records arrived together: the impact wins
+  if (ImpactRecord.bValid)
+    return;
+
+  SetActorLocationAndRotation(LaunchRecord.Origin,
+                              LaunchRecord.Velocity.Rotation());
+  StartFlight(LaunchRecord.Velocity);
+
+  // Catch up with the server's hook (one-way latency)
+  const double Elapsed =
+      GetServerTime(GetWorld()) - LaunchRecord.ServerLaunchTime;
+  FastForwardFlight(FMath::Clamp(static_cast<float>(Elapsed), 0.f,
+                                 MaxFastForwardTime));
+}
+
+void ARopeHookActor::OnRep_ImpactRecord() {
+  if (!ImpactRecord.bValid)
+    return;
+
+  StopFlight();
+  SetActorLocation(ImpactRecord.Location);
+
+  FHitResult Hit;
+  Hit.bBlockingHit = true;
+  Hit.Location = ImpactRecord.Location;
+  Hit.ImpactPoint = ImpactRecord.ImpactPoint;
+  Hit.Normal = ImpactRecord.ImpactNormal;
+  Hit.ImpactNormal = ImpactRecord.ImpactNormal;
+  Hit.Component = ImpactRecord.Component;
+  Hit.HitObjectHandle = FActorInstanceHandle(
+      ImpactRecord.Component ? ImpactRecord.Component->GetOwner() : nullptr);
+
+  // Snap, attach and notify exactly as the server did
+  HandleHookImpact(Hit);
+}
+
 void ARopeHookActor::UpdateHookOrientation(const FVector &Velocity,
                                            float DeltaTime) {
   if (bImpacted || Velocity.IsNearlyZero())
@@ -4,7 +4,6 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
-#include "GameFramework/ProjectileMovementComponent.h"
 #include "RopeHookActor.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnHookImpactSignature,
@@ -12,7 +11,48 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnHookImpactSignature,
 
 class USphereComponent;
 class UStaticMeshComponent;
-class UProjectileMovementComponent;
+
+/**
+ * Everything a client needs to simulate the flight: the arc is fully
+ * determined by origin, velocity and gravity.
+ */
+USTRUCT(BlueprintType)
+struct FHookLaunchRecord {
+  GENERATED_BODY();
+
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+  FVector_NetQuantize Origin = FVector::ZeroVector;
+
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+  FVector_NetQuantize10 Velocity = FVector::ZeroVector;
+
+  /** Server world time of the launch (GetServerWorldTimeSeconds) */
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+  double ServerLaunchTime = 0.0;
+};
+
+/** Where the server stopped the hook (impact or reel-in) */
+USTRUCT(BlueprintType)
+struct FHookImpactRecord {
+  GENERATED_BODY();
+
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+  bool bValid = false;
+
+  /** Hook (sphere center) location */
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+  FVector_NetQuantize Location = FVector::ZeroVector;
+
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+  FVector_NetQuantize ImpactPoint = FVector::ZeroVector;
+
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+  FVector_NetQuantizeNormal ImpactNormal = FVector::UpVector;
+
+  /** Null if static or not net-addressable: the hook then stays in place */
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+  TObjectPtr<UPrimitiveComponent> Component = nullptr;
+};
 
 UCLASS()
 class LINKMEPROJECT_API ARopeHookActor : public AActor {
@@ -21,7 +61,8 @@ class LINKMEPROJECT_API ARopeHookActor : public AActor {
 public:
   ARopeHookActor();
 
-  virtual void Tick(float DeltaTime) override;
+  virtual void GetLifetimeReplicatedProps(
+      TArray<FLifetimeProperty> &OutLifetimeProps) const override;
 
   /** Fire hook forward with an impulse. */
   UFUNCTION(BlueprintCallable, Category = "Rope")
@@ -53,17 +94,96 @@ public:
   UFUNCTION(BlueprintCallable, Category = "Rope")
   void UpdateHookOrientation(const FVector &Velocity, float DeltaTime);
 
-  // Exposed Publicly for RopeSystemComponent
-  UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Movement")
-  class UProjectileMovementComponent *ProjectileMovement;
+  // ===================================================================
+  // FLIGHT
+  // ===================================================================
+
+  /** Halt the flight where the hook is (impact, reel-in). No-op if landed. */
+  UFUNCTION(BlueprintCallable, Category = "Movement")
+  void StopFlight();
+
+  UFUNCTION(BlueprintPure, Category = "Movement")
+  bool IsFlying() const { return bFlying; }
+
+  UFUNCTION(BlueprintPure, Category = "Movement")
+  FVector GetFlightVelocity() const { return FlightVelocity; }
+
+  /**
+   * Stop the flight at Location (server: also replicated as the impact
+   * record, since movement is not replicated). Used by reel-in.
+   */
+  void LandAt(const FVector &Location, UPrimitiveComponent *Component);
+
+  /**
+   * Server: run the flight sweeps this far in the past (client latency), so
+   * moving targets are hit where the shooter saw them. 0 disables rewind.
+   */
+  void SetRewindLatency(float Latency) { RewindLatency = Latency; }
+
+  /**
+   * One frame of ballistic flight, called by UHookFlightSubsystem.
+   * Gravity is integrated exactly per substep and each substep sweeps the
+   * collision sphere along its chord, so the swept path is continuous and
+   * fast shots cannot tunnel. Stops at the first blocking hit.
+   */
+  void TickFlight(float DeltaTime);
+
+  // Replaces the removed ProjectileMovement component; Blueprint overrides
+  // of it must be moved here (see Docs/RopeSystem.md, Migration)
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement")
+  float GravityScale = 1.0f;
+
+  /** Speed clamp, as ProjectileMovement's MaxSpeed (0 = no limit) */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement",
+            meta = (ClampMin = "0"))
+  float MaxSpeed = 3500.f;
+
+  /** Pawns are ignored this long after launch (s) */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement",
+            meta = (ClampMin = "0"))
+  float SafeLaunchTime = 0.2f;
+
+  /** Substep length: keeps the swept chords close to the parabola (cm) */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement",
+            meta = (ClampMin = "10"))
+  float MaxSubstepDistance = 100.f;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement",
+            meta = (ClampMin = "1", ClampMax = "32"))
+  int32 MaxSubsteps = 8;
+
+  /** Latency a client catches up on when the launch record arrives (s) */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Network",
+            meta = (ClampMin = "0"))
+  float MaxFastForwardTime = 0.5f;
 
 protected:
   virtual void BeginPlay() override;
+  virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+  void StartFlight(const FVector &Velocity);
+  void HandleHookImpact(const FHitResult &Hit);
+  void FastForwardFlight(float Time);
+
+  // ===================================================================
+  // REPLICATION (movement is not replicated, see FHookLaunchRecord)
+  // ===================================================================
+
+  UPROPERTY(ReplicatedUsing = OnRep_LaunchRecord)
+  FHookLaunchRecord LaunchRecord;
+
+  UPROPERTY(ReplicatedUsing = OnRep_ImpactRecord)
+  FHookImpactRecord ImpactRecord;
+
+  UFUNCTION()
+  void OnRep_LaunchRecord();
 
   UFUNCTION()
-  void HandleHookImpact(UPrimitiveComponent *HitComp, AActor *OtherActor,
-                        UPrimitiveComponent *OtherComp, FVector NormalImpulse,
-                        const FHitResult &Hit);
+  void OnRep_ImpactRecord();
+
+  void RecordImpact(const FVector &ImpactPoint, const FVector &ImpactNormal,
+                    UPrimitiveComponent *Component);
 
 protected:
   UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Rope")
@@ -72,14 +192,23 @@ protected:
   UPROPERTY()
   USphereComponent *CollisionComponent;
 
-  FTimerHandle SafeLaunchTimerHandle;
-
-  UFUNCTION()
-  void ReEnablePawnCollision();
-
   UPROPERTY(EditAnywhere, Category = "Rope")
   float LaunchImpulse = 3500.f;
 
   bool bImpacted = false;
   FHitResult ImpactResult;
+
+  // Flight state
+  bool bFlying = false;
+  FVector FlightVelocity = FVector::ZeroVector;
+  float FlightTime = 0.f;
+
+  /** Built at launch from the sphere's responses and move-ignore lists */
+  FCollisionQueryParams FlightQueryParams;
+  FCollisionResponseParams FlightResponseParams;
+  /** Same, with pawns ignored (first SafeLaunchTime seconds) */
+  FCollisionResponseParams SafeLaunchResponseParams;
+
+  /** See SetRewindLatency */
+  float RewindLatency = 0.f;
 };
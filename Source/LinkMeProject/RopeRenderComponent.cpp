@@ -3,6 +3,10 @@
 #include "RopeRenderComponent.h"
 #include "DrawDebugHelpers.h"
 #include "Engine/Engine.h"
+#include "LinkMeProject.h"
+#include "RopeSimScheduler.h"
+
+DECLARE_CYCLE_STAT(TEXT("Rope Render Sim"), STAT_RopeRenderSim, STATGROUP_LinkMe);
 
 URopeRenderComponent::URopeRenderComponent()
 {
@@ -13,22 +17,103 @@ URopeRenderComponent::URopeRenderComponent()
 void URopeRenderComponent::BeginPlay()
 {
 	Super::BeginPlay();
+
+	bRunCosmetics = LinkMe::ShouldRunCosmetics(GetWorld());
+	if (!bRunCosmetics)
+	{
+		// Purely visual: drop the tick and the spline from the scene
+		SetComponentTickEnabled(false);
+		if (RopeSpline && RopeSpline->IsRegistered())
+		{
+			RopeSpline->UnregisterComponent();
+		}
+		return;
+	}
+
+	Scheduler = GetWorld()->GetSubsystem<URopeSimScheduler>();
+
 	ResetSimulation();
 }
 
+void URopeRenderComponent::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+	Super::GetResourceSizeEx(CumulativeResourceSize);
+
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(
+		Particles.GetAllocatedSize() + PinConstraints.GetAllocatedSize() +
+		DistanceConstraints.GetAllocatedSize() + PathCache.GetAllocatedSize() +
+		SplineMeshes.GetAllocatedSize());
+}
+
 void URopeRenderComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
 	if (bInitialized && !bRopeHidden)
 	{
-		SimulateXPBD(DeltaTime);
-		UpdateMeshes();
+		// Pins are final here (late update); the step itself shares the frame budget
+		if (Scheduler)
+		{
+			Scheduler->RequestSimulation(this, DeltaTime);
+		}
+		else
+		{
+			StepSimulation(DeltaTime);
+		}
 	}
 }
 
+void URopeRenderComponent::StepSimulation(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_RopeRenderSim);
+
+	if (!bInitialized || bRopeHidden) return;
+
+	SimulateXPBD(DeltaTime);
+	UpdateMeshes();
+	OnStepped.ExecuteIfBound();
+}
+
+void URopeRenderComponent::StepExtrapolation(float DeltaTime)
+{
+	if (!bInitialized || bRopeHidden) return;
+
+	const float Drag = FMath::Clamp(1.0f - Damping * DeltaTime, 0.0f, 1.0f);
+	for (FRopeParticle& P : Particles)
+	{
+		if (P.InverseMass == 0.0f)
+		{
+			P.PredictedPosition = P.Position;
+			continue;
+		}
+
+		P.Velocity *= Drag;
+		P.Position += P.Velocity * DeltaTime;
+		P.PredictedPosition = P.Position;
+	}
+
+	UpdateMeshes();
+	OnStepped.ExecuteIfBound();
+}
+
+FSphere URopeRenderComponent::GetSimulationBounds() const
+{
+	if (Particles.Num() == 0) return FSphere(GetComponentLocation(), 0.f);
+
+	const FVector& Start = Particles[0].Position;
+	const FVector& End = Particles.Last().Position;
+	return FSphere((Start + End) * 0.5f, FVector::Dist(Start, End) * 0.5f + RopeThickness);
+}
+
 void URopeRenderComponent::UpdateRope(const TArray<FVector>& Points, bool bDeployingMode)
 {
+	UpdateRopePoints(Points, bDeployingMode);
+}
+
+void URopeRenderComponent::UpdateRopePoints(TConstArrayView<FVector> Points, bool bDeployingMode)
+{
+	if (!bRunCosmetics) return;
+
 	if (Points.Num() < 2) 
     {
         HideRope();
@@ -55,7 +140,7 @@ void URopeRenderComponent::UpdateRope(const TArray<FVector>& Points, bool bDeplo
         // If Deploying, we might want to update the "Tail" particle to the new Hook position
         // The Physics solver will handle the rest.
         // We do NOT rebuild every frame to preserve momentum.
-        UpdatePinPositions(Points);
+        PinEndpoints(Points);
     }
 }
 
@@ -73,13 +158,19 @@ void URopeRenderComponent::SetRopeHidden(bool bHidden)
 
 void URopeRenderComponent::ResetSimulation()
 {
+    // Keep the allocations for the next shot
     bInitialized = false;
-    Particles.Empty();
-    PinConstraints.Empty();
-    DistanceConstraints.Empty();
+    Particles.Reset();
+    PinConstraints.Reset();
+    DistanceConstraints.Reset();
 }
 
 void URopeRenderComponent::UpdatePinPositions(const TArray<FVector>& Points)
+{
+    PinEndpoints(Points);
+}
+
+void URopeRenderComponent::PinEndpoints(TConstArrayView<FVector> Points)
 {
     if (Points.Num() < 2 || Particles.Num() == 0) return;
 
@@ -117,45 +208,42 @@ void URopeRenderComponent::UpdatePinPositions(const TArray<FVector>& Points)
     // By forcing Particles.Last() = Points.Last(), we ensure visual attachment.
 }
 
-void URopeRenderComponent::RebuildFromPoints(const TArray<FVector>& Points)
+float URopeRenderComponent::PinPlayerEnd(const FVector& Location, bool bAtStart)
+{
+    if (!bInitialized || Particles.Num() == 0) return 0.f;
+
+    FRopeParticle& End = bAtStart ? Particles[0] : Particles.Last();
+    const float Correction = FVector::Dist(End.Position, Location);
+    End.Position = Location;
+    End.PredictedPosition = Location;
+    End.InverseMass = 0.0f;
+    return Correction;
+}
+
+FVector URopeRenderComponent::GetPlayerEndPosition(bool bAtStart) const
+{
+    if (Particles.Num() == 0) return GetComponentLocation();
+    return bAtStart ? Particles[0].Position : Particles.Last().Position;
+}
+
+void URopeRenderComponent::RebuildFromPoints(TConstArrayView<FVector> Points)
 {
     if (Points.Num() < 2) return;
 
     // Distribute N particles along the path
     Particles.SetNum(ParticleCount);
     
-    float TotalDist = 0.0f;
-    for(int i=0; i<Points.Num()-1; ++i) TotalDist += FVector::Dist(Points[i], Points[i+1]);
+    // Prefix-summed path: one pass to build, O(log n) per particle lookup
+    const FVector& PathEnd = Points.Last();
+    PathCache.Rebuild(Points, Points.Num() - 1);
+    float TotalDist = PathCache.GetPolylineLength(PathEnd);
     
     float Step = TotalDist / (float)(ParticleCount - 1);
-    float CurrentDist = 0.0f;
-    int32 SegIdx = 0;
     
     // Fill Particles
     for(int i=0; i<ParticleCount; ++i)
     {
-        // Logic to find pos on polyline (borrowed from Blended version, same math)
-        // ... (Simplified for brevity, assuming linear interp)
-        // For simplicity: lerp whole line if simple, or walk segments.
-        // Let's implement the segment walk properly.
-        
-        float Target = (float)i * Step;
-        while(SegIdx < Points.Num()-1 && CurrentDist + FVector::Dist(Points[SegIdx], Points[SegIdx+1]) < Target)
-        {
-            CurrentDist += FVector::Dist(Points[SegIdx], Points[SegIdx+1]);
-            SegIdx++;
-        }
-        
-        if (SegIdx < Points.Num() - 1)
-        {
-            float SegLen = FVector::Dist(Points[SegIdx], Points[SegIdx+1]);
-            float Alpha = (Target - CurrentDist) / FMath::Max(0.01f, SegLen);
-            Particles[i].Position = FMath::Lerp(Points[SegIdx], Points[SegIdx+1], Alpha);
-        }
-        else
-        {
-            Particles[i].Position = Points.Last();
-        }
+        Particles[i].Position = PathCache.GetPointAtDistance((float)i * Step, PathEnd);
         
         Particles[i].OldPosition = Particles[i].Position; // Zero init velocity
         Particles[i].PredictedPosition = Particles[i].Position;
@@ -168,7 +256,7 @@ void URopeRenderComponent::RebuildFromPoints(const TArray<FVector>& Points)
     Particles.Last().InverseMass = 0.0f;
     
     // Build Constraints
-    DistanceConstraints.Empty();
+    DistanceConstraints.Reset();
     float NominalRestLen = TotalDist / (float)(ParticleCount - 1); // Or slightly loose?
     for(int i=0; i<ParticleCount-1; ++i)
     {
@@ -184,9 +272,10 @@ void URopeRenderComponent::RebuildFromPoints(const TArray<FVector>& Points)
 
 void URopeRenderComponent::SimulateXPBD(float DeltaTime)
 {
-    float SubStepDt = DeltaTime / (float)SubSteps;
+    const int32 NumSubSteps = FMath::Max(SubSteps >> SimulationLOD, 1);
+    float SubStepDt = DeltaTime / (float)NumSubSteps;
     
-    for(int Step=0; Step<SubSteps; ++Step)
+    for(int Step=0; Step<NumSubSteps; ++Step)
     {
         // 1. Predict
         for(auto& P : Particles)
@@ -221,7 +310,8 @@ void URopeRenderComponent::SimulateXPBD(float DeltaTime)
 
 void URopeRenderComponent::SolveConstraints(float Dt)
 {
-    for(int It=0; It<SolverIterations; ++It)
+    const int32 NumIterations = FMath::Max(SolverIterations >> SimulationLOD, 1);
+    for(int It=0; It<NumIterations; ++It)
     {
         // Distance
         for(const auto& C : DistanceConstraints)
@@ -277,10 +367,23 @@ void URopeRenderComponent::SolveConstraints(float Dt)
 void URopeRenderComponent::UpdateMeshes()
 {
     if(!RopeSpline) return;
-    RopeSpline->ClearSplinePoints(false);
-    for(const auto& P : Particles)
+
+    // Same particle count frame to frame: move the points in place instead of
+    // clearing and re-adding them (no reallocation of the spline curves)
+    if (RopeSpline->GetNumberOfSplinePoints() != Particles.Num())
     {
-        RopeSpline->AddSplinePoint(P.Position, ESplineCoordinateSpace::World, false);
+        RopeSpline->ClearSplinePoints(false);
+        for(const auto& P : Particles)
+        {
+            RopeSpline->AddSplinePoint(P.Position, ESplineCoordinateSpace::World, false);
+        }
+    }
+    else
+    {
+        for(int32 i=0; i<Particles.Num(); ++i)
+        {
+            RopeSpline->SetLocationAtSplinePoint(i, Particles[i].Position, ESplineCoordinateSpace::World, false);
+        }
     }
     RopeSpline->UpdateSpline();
     
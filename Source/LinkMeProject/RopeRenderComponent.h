@@ -6,8 +6,11 @@
 #include "Components/SceneComponent.h"
 #include "Components/SplineComponent.h"
 #include "Components/SplineMeshComponent.h"
+#include "RopeGeometryCache.h"
 #include "RopeRenderComponent.generated.h"
 
+class URopeSimScheduler;
+
 // XPBD Particle
 struct FRopeParticle
 {
@@ -58,16 +61,30 @@ public:
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 	virtual void BeginPlay() override;
 
+	/** Simulation buffers and segment pool (obj list, memreport) */
+	virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+
 	/**
      * Rebuilds the rope topology.
      */
 	UFUNCTION(BlueprintCallable, Category = "Rope")
 	void UpdateRope(const TArray<FVector>& Points, bool bDeployingMode = false);
 
+	/** Same as UpdateRope, for callers building the points in scratch memory */
+	void UpdateRopePoints(TConstArrayView<FVector> Points, bool bDeployingMode = false);
+
     /** Updates just the pin positions (Endpoints/Corners) without topology rebuild */
     UFUNCTION(BlueprintCallable, Category = "Rope")
     void UpdatePinPositions(const TArray<FVector>& Points);
 
+    /** Moves the pinned player end only (late update, after animation).
+     * bAtStart: first particle (flying rope), else the last one.
+     * Returns how far the pin moved (cm). */
+    float PinPlayerEnd(const FVector& Location, bool bAtStart);
+
+    /** Simulated position of the player end (same bAtStart as PinPlayerEnd) */
+    FVector GetPlayerEndPosition(bool bAtStart) const;
+
     UFUNCTION(BlueprintCallable, Category = "Rope")
     void SetRopeDeploying(bool bDeploying);
 
@@ -83,6 +100,21 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Rope")
     void SetRopeHidden(bool bHidden);
 
+    /** Halves sub-steps and solver iterations per level (significance) */
+    void SetSimulationLOD(int32 InLOD) { SimulationLOD = FMath::Max(InLOD, 0); }
+
+    /** One XPBD step + mesh update (run by URopeSimScheduler) */
+    void StepSimulation(float DeltaTime);
+
+    /** Over budget: moves the free particles along their last velocity */
+    void StepExtrapolation(float DeltaTime);
+
+    /** Fired after each simulation or extrapolation step */
+    FSimpleDelegate OnStepped;
+
+    /** Sphere through both ends, for the scheduler's screen size */
+    FSphere GetSimulationBounds() const;
+
     UPROPERTY(EditAnywhere, Category="Rope|Debug")
     bool bShowDebugSpline = false;
 
@@ -127,10 +159,28 @@ protected:
 	TArray<FPinnedConstraint> PinConstraints;
 	TArray<FDistanceConstraint> DistanceConstraints;
 
+	// Arc-length lookup over the logical rope path (reused between rebuilds)
+	FRopeGeometryCache PathCache;
+
 	bool bInitialized = false;
     bool bRopeHidden = false;
     bool bIsDeploying = false;
 
+	// False on a dedicated server: no simulation, spline unregistered
+	bool bRunCosmetics = true;
+
+	// 0 = SubSteps / SolverIterations as configured
+	int32 SimulationLOD = 0;
+
+	// Null if the world has none: the tick simulates directly
+	UPROPERTY(Transient)
+	URopeSimScheduler* Scheduler = nullptr;
+
+	// Scheduler bookkeeping: smoothed step cost, steps skipped in a row
+	friend class URopeSimScheduler;
+	float SimCostMs = 0.f;
+	int32 FramesExtrapolated = 0;
+
 	// --- Components ---
 	UPROPERTY()
 	USplineComponent* RopeSpline;
@@ -141,7 +191,8 @@ protected:
 	// --- Internal ---
 	void SimulateXPBD(float DeltaTime);
 	void SolveConstraints(float Dt);
-	void RebuildFromPoints(const TArray<FVector>& Points);
+	void RebuildFromPoints(TConstArrayView<FVector> Points);
+	void PinEndpoints(TConstArrayView<FVector> Points);
 	void UpdateMeshes();
 	void HideUnusedSegments(int32 ActiveCount);
     void ResetSimulation();
@@ -0,0 +1,252 @@
+// RopeRewindSubsystem.cpp
+
+#include "RopeRewindSubsystem.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "HookableTargetSubsystem.h"
+#include "LinkMeProject.h"
+
+DECLARE_CYCLE_STAT(TEXT("Rewind Snapshot"), STAT_RewindSnapshot,
+                   STATGROUP_LinkMe);
+DECLARE_CYCLE_STAT(TEXT("Rewind Sweep"), STAT_RewindSweep, STATGROUP_LinkMe);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Rewind Tracked Actors"),
+                           STAT_RewindTrackedActors, STATGROUP_LinkMe);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Rewind History Bytes"),
+                           STAT_RewindHistoryBytes, STATGROUP_LinkMe);
+
+void URopeRewindSubsystem::Deinitialize() {
+  Histories.Empty();
+  ExplicitActors.Empty();
+  Super::Deinitialize();
+}
+
+bool URopeRewindSubsystem::DoesSupportWorldType(
+    const EWorldType::Type WorldType) const {
+  return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId URopeRewindSubsystem::GetStatId() const {
+  RETURN_QUICK_DECLARE_CYCLE_STAT(URopeRewindSubsystem, STATGROUP_LinkMe);
+}
+
+bool URopeRewindSubsystem::IsTickable() const {
+  // Only a server with remote clients has latency to compensate
+  const UWorld *World = GetWorld();
+  if (!World)
+    return false;
+  const ENetMode NetMode = World->GetNetMode();
+  return NetMode == NM_DedicatedServer || NetMode == NM_ListenServer;
+}
+
+int32 URopeRewindSubsystem::GetCapacity() const {
+  // +1: a full window needs both ends
+  return FMath::Max(2, FMath::CeilToInt(MaxRewindTime / SnapshotInterval) + 1);
+}
+
+double URopeRewindSubsystem::GetOldestRewindTime() const {
+  return LastSnapshotTime - MaxRewindTime;
+}
+
+// ===================================================================
+// REGISTRATION
+// ===================================================================
+
+void URopeRewindSubsystem::RegisterActor(AActor *Actor) {
+  if (IsValid(Actor)) {
+    ExplicitActors.AddUnique(Actor);
+  }
+}
+
+void URopeRewindSubsystem::UnregisterActor(AActor *Actor) {
+  ExplicitActors.RemoveSingleSwap(Actor);
+  Histories.Remove(Actor);
+}
+
+// ===================================================================
+// SNAPSHOTS
+// ===================================================================
+
+void URopeRewindSubsystem::Tick(float DeltaTime) {
+  const double Now = GetWorld()->GetTimeSeconds();
+  if (LastSnapshotTime >= 0.0 && Now - LastSnapshotTime < SnapshotInterval)
+    return;
+
+  RecordSnapshot(Now);
+  LastSnapshotTime = Now;
+}
+
+void URopeRewindSubsystem::RecordSnapshot(double Now) {
+  SCOPE_CYCLE_COUNTER(STAT_RewindSnapshot);
+
+  const int32 Capacity = GetCapacity();
+
+  auto Record = [&](AActor *Actor) {
+    if (!IsValid(Actor))
+      return;
+
+    FTransformHistory &History = Histories.FindOrAdd(Actor);
+    if (History.Samples.Num() != Capacity) {
+      History.Samples.SetNum(Capacity);
+      History.Head = INDEX_NONE;
+      History.Num = 0;
+    }
+
+    History.Head = (History.Head + 1) % Capacity;
+    History.Num = FMath::Min(History.Num + 1, Capacity);
+
+    FRewindSample &Sample = History.Samples[History.Head];
+    Sample.Time = Now;
+    Sample.Location = Actor->GetActorLocation();
+    Sample.Rotation = Actor->GetActorQuat();
+  };
+
+  // Static targets never move: only the registry's movable ones matter
+  if (const UHookableTargetSubsystem *Registry =
+          GetWorld()->GetSubsystem<UHookableTargetSubsystem>()) {
+    for (const TWeakObjectPtr<AActor> &Target : Registry->GetMovingTargets()) {
+      Record(Target.Get());
+    }
+  }
+  for (const TWeakObjectPtr<AActor> &Actor : ExplicitActors) {
+    Record(Actor.Get());
+  }
+
+  // Anything not sampled this time has left both lists
+  for (auto It = Histories.CreateIterator(); It; ++It) {
+    const FTransformHistory &History = It.Value();
+    if (!It.Key().IsValid() || History.Head == INDEX_NONE ||
+        History.Samples[History.Head].Time != Now) {
+      It.RemoveCurrent();
+    }
+  }
+
+  INC_DWORD_STAT_BY(STAT_RewindTrackedActors, Histories.Num());
+  INC_DWORD_STAT_BY(STAT_RewindHistoryBytes,
+                    Histories.Num() * Capacity * sizeof(FRewindSample));
+}
+
+bool URopeRewindSubsystem::GetTransformAt(const FTransformHistory &History,
+                                          double Time,
+                                          FTransform &OutTransform) const {
+  if (History.Num == 0)
+    return false;
+
+  const int32 Capacity = History.Samples.Num();
+  auto At = [&](int32 Back) -> const FRewindSample & {
+    return History.Samples[(History.Head - Back + Capacity) % Capacity];
+  };
+
+  // Newer than the last snapshot: the current transform is the answer
+  if (Time >= At(0).Time)
+    return false;
+
+  const FRewindSample &Oldest = At(History.Num - 1);
+  if (History.Num == 1 || Time <= Oldest.Time) {
+    OutTransform = FTransform(Oldest.Rotation, Oldest.Location);
+    return true;
+  }
+
+  // Samples are (nearly) evenly spaced: index straight to the bracket, then
+  // fix up for frame hitches
+  int32 Back = FMath::Clamp(
+      FMath::CeilToInt((At(0).Time - Time) / SnapshotInterval), 1,
+      History.Num - 1);
+  while (Back < History.Num - 1 && At(Back).Time > Time)
+    ++Back;
+  while (Back > 1 && At(Back - 1).Time <= Time)
+    --Back;
+
+  const FRewindSample &Older = At(Back);
+  const FRewindSample &Newer = At(Back - 1);
+  const double Span = Newer.Time - Older.Time;
+  const float Alpha =
+      Span > 0.0 ? FMath::Clamp(float((Time - Older.Time) / Span), 0.f, 1.f)
+                 : 1.f;
+
+  OutTransform =
+      FTransform(FQuat::Slerp(Older.Rotation, Newer.Rotation, Alpha),
+                 FMath::Lerp(Older.Location, Newer.Location, Alpha));
+  return true;
+}
+
+// ===================================================================
+// QUERIES
+// ===================================================================
+
+bool URopeRewindSubsystem::SweepAt(
+    double Time, FHitResult &OutHit, const FVector &Start, const FVector &End,
+    ECollisionChannel Channel, const FCollisionShape &Shape,
+    const FCollisionQueryParams &Params,
+    const FCollisionResponseParams &ResponseParams,
+    const AActor *SourceActor) const {
+  SCOPE_CYCLE_COUNTER(STAT_RewindSweep);
+
+  UWorld *World = GetWorld();
+  if (Histories.Num() == 0 || Time >= LastSnapshotTime) {
+    return World->SweepSingleByChannel(OutHit, Start, End, FQuat::Identity,
+                                       Channel, Shape, Params,
+                                       ResponseParams);
+  }
+
+  const AActor *SourceOwner = SourceActor ? SourceActor->GetOwner() : nullptr;
+
+  // Everything that does not move, as usual
+  FCollisionQueryParams WorldParams = Params;
+  for (const auto &Pair : Histories) {
+    if (AActor *Actor = Pair.Key.Get()) {
+      WorldParams.AddIgnoredActor(Actor);
+    }
+  }
+  bool bHit = World->SweepSingleByChannel(OutHit, Start, End, FQuat::Identity,
+                                          Channel, Shape, WorldParams,
+                                          ResponseParams);
+
+  const float ShapeRadius = Shape.GetExtent().Size();
+
+  for (const auto &Pair : Histories) {
+    AActor *Actor = Pair.Key.Get();
+    if (!Actor || Actor == SourceActor || Actor == SourceOwner)
+      continue;
+
+    FTransform Rewound;
+    if (!GetTransformAt(Pair.Value, Time, Rewound))
+      continue;
+
+    // The actor is rigid: hitting it at its rewound transform is hitting it
+    // where it is now with the sweep carried along. Hits are reported in the
+    // current frame, where the hook will actually attach.
+    const FTransform RewoundToCurrent =
+        Rewound.Inverse() * Actor->GetActorTransform();
+    const FVector MovedStart = RewoundToCurrent.TransformPosition(Start);
+    const FVector MovedEnd = RewoundToCurrent.TransformPosition(End);
+    const FQuat MovedRotation = RewoundToCurrent.GetRotation();
+
+    Actor->ForEachComponent<UPrimitiveComponent>(
+        false, [&](UPrimitiveComponent *Prim) {
+          if (!Prim->IsQueryCollisionEnabled())
+            return;
+          // Both sides must block, as in a channel sweep
+          if (ResponseParams.CollisionResponse.GetResponse(
+                  Prim->GetCollisionObjectType()) != ECR_Block ||
+              Prim->GetCollisionResponseToChannel(Channel) != ECR_Block)
+            return;
+
+          // Broad phase on the bounding sphere
+          if (FMath::PointDistToSegment(Prim->Bounds.Origin, MovedStart,
+                                        MovedEnd) >
+              Prim->Bounds.SphereRadius + ShapeRadius)
+            return;
+
+          FHitResult PrimHit;
+          if (Prim->SweepComponent(PrimHit, MovedStart, MovedEnd,
+                                   MovedRotation, Shape,
+                                   Params.bTraceComplex) &&
+              (!bHit || PrimHit.Time < OutHit.Time)) {
+            OutHit = PrimHit;
+            bHit = true;
+          }
+        });
+  }
+
+  return bHit;
+}
@@ -0,0 +1,96 @@
+// RopeRewindSubsystem.h
+// Server-side transform history for lag-compensated hook sweeps
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "RopeRewindSubsystem.generated.h"
+
+/**
+ * Short transform history of moving hook targets, kept on the server only.
+ *
+ * Every SnapshotInterval the subsystem records the transform of each movable
+ * hookable actor (from UHookableTargetSubsystem) and of any actor registered
+ * explicitly (moving platforms). Histories are fixed-size ring buffers
+ * sampled at a fixed rate, so the sample for a given time is found by index
+ * arithmetic instead of a search.
+ *
+ * SweepAt() runs a sweep "as the client saw it": the world is swept as
+ * usual with tracked actors ignored, then each tracked actor's primitives
+ * are swept individually with the ray moved into the actor's rewound frame.
+ */
+UCLASS()
+class LINKMEPROJECT_API URopeRewindSubsystem : public UTickableWorldSubsystem {
+  GENERATED_BODY()
+
+public:
+  virtual void Deinitialize() override;
+
+  virtual void Tick(float DeltaTime) override;
+  virtual TStatId GetStatId() const override;
+  virtual bool IsTickable() const override;
+
+  /** Track a moving actor that is not a hookable target (e.g. platform) */
+  UFUNCTION(BlueprintCallable, Category = "Rope|Rewind")
+  void RegisterActor(AActor *Actor);
+
+  UFUNCTION(BlueprintCallable, Category = "Rope|Rewind")
+  void UnregisterActor(AActor *Actor);
+
+  /** Oldest time SweepAt can rewind to (now - history length) */
+  double GetOldestRewindTime() const;
+
+  /**
+   * Sweep against the world with tracked actors at their transform at Time.
+   * Same contract as UWorld::SweepSingleByChannel; falls back to a plain
+   * sweep if nothing is tracked or Time is current. Hits on tracked actors
+   * are reported where those actors are now.
+   *
+   * @param SourceActor the sweeping actor; it and its owner are skipped
+   */
+  bool SweepAt(double Time, FHitResult &OutHit, const FVector &Start,
+               const FVector &End, ECollisionChannel Channel,
+               const FCollisionShape &Shape,
+               const FCollisionQueryParams &Params,
+               const FCollisionResponseParams &ResponseParams,
+               const AActor *SourceActor = nullptr) const;
+
+  /** Time between snapshots (s) */
+  UPROPERTY(EditAnywhere, Category = "Rope|Rewind", meta = (ClampMin = "0.005"))
+  float SnapshotInterval = 1.f / 60.f;
+
+  /** How far back a sweep may rewind (s). Sets the buffer size. */
+  UPROPERTY(EditAnywhere, Category = "Rope|Rewind", meta = (ClampMin = "0.05"))
+  float MaxRewindTime = 0.5f;
+
+protected:
+  virtual bool DoesSupportWorldType(
+      const EWorldType::Type WorldType) const override;
+
+private:
+  struct FRewindSample {
+    double Time = 0.0;
+    FVector Location = FVector::ZeroVector;
+    FQuat Rotation = FQuat::Identity;
+  };
+
+  /** Fixed-capacity ring, newest at Head */
+  struct FTransformHistory {
+    TArray<FRewindSample> Samples;
+    int32 Head = INDEX_NONE;
+    int32 Num = 0;
+  };
+
+  int32 GetCapacity() const;
+  void RecordSnapshot(double Now);
+  bool GetTransformAt(const FTransformHistory &History, double Time,
+                      FTransform &OutTransform) const;
+
+  TMap<TWeakObjectPtr<AActor>, FTransformHistory> Histories;
+
+  /** Registered through RegisterActor (hookables come from the registry) */
+  TArray<TWeakObjectPtr<AActor>> ExplicitActors;
+
+  double LastSnapshotTime = -1.0;
+};
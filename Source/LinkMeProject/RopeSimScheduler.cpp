@@ -0,0 +1,152 @@
+// RopeSimScheduler.cpp
+
+#include "RopeSimScheduler.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/PlatformTime.h"
+#include "LinkMeProject.h"
+#include "RopeRenderComponent.h"
+
+DECLARE_CYCLE_STAT(TEXT("Rope Sim Scheduler"), STAT_RopeSimScheduler,
+                   STATGROUP_LinkMe);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ropes Simulated"), STAT_RopesSimulated,
+                           STATGROUP_LinkMe);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ropes Extrapolated"), STAT_RopesExtrapolated,
+                           STATGROUP_LinkMe);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Rope Sim Budget Used (ms)"),
+                           STAT_RopeSimBudgetUsed, STATGROUP_LinkMe);
+
+namespace {
+
+// Weight of the newest measurement in a rope's cost estimate
+constexpr float CostSmoothing = 0.25f;
+
+} // namespace
+
+// ===================================================================
+// LIFECYCLE
+// ===================================================================
+
+bool URopeSimScheduler::DoesSupportWorldType(
+    const EWorldType::Type WorldType) const {
+  return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void URopeSimScheduler::Deinitialize() {
+  Requests.Reset();
+  Super::Deinitialize();
+}
+
+TStatId URopeSimScheduler::GetStatId() const {
+  RETURN_QUICK_DECLARE_CYCLE_STAT(URopeSimScheduler, STATGROUP_LinkMe);
+}
+
+bool URopeSimScheduler::IsTickable() const {
+  const UWorld *World = GetWorld();
+  return World && LinkMe::ShouldRunCosmetics(World);
+}
+
+// ===================================================================
+// REQUESTS
+// ===================================================================
+
+void URopeSimScheduler::RequestSimulation(URopeRenderComponent *Rope,
+                                          float DeltaTime) {
+  const APawn *OwnerPawn = Cast<APawn>(Rope->GetOwner());
+
+  FRequest &Request = Requests.AddDefaulted_GetRef();
+  Request.Rope = Rope;
+  Request.DeltaTime = DeltaTime;
+  Request.bLocal = OwnerPawn && OwnerPawn->IsLocallyControlled();
+}
+
+float URopeSimScheduler::GetPriority(const URopeRenderComponent &Rope) const {
+  const FSphere Bounds = Rope.GetSimulationBounds();
+
+  float ClosestDistSq = UE_MAX_FLT;
+  for (const FVector &View : ViewLocations) {
+    ClosestDistSq =
+        FMath::Min(ClosestDistSq, FVector::DistSquared(View, Bounds.Center));
+  }
+  const float Distance = ViewLocations.IsEmpty()
+                             ? 1.f
+                             : FMath::Max(FMath::Sqrt(ClosestDistSq), 1.f);
+
+  // Projected radius, up to the view's FOV factor shared by every rope
+  const float ScreenSize = Bounds.W / Distance;
+  return ScreenSize * float(1 + Rope.FramesExtrapolated);
+}
+
+// ===================================================================
+// TICK
+// ===================================================================
+
+void URopeSimScheduler::Tick(float DeltaTime) {
+  SCOPE_CYCLE_COUNTER(STAT_RopeSimScheduler);
+
+  FRopeSimFrameStats Stats;
+
+  if (!Requests.IsEmpty()) {
+    ViewLocations.Reset();
+    for (FConstPlayerControllerIterator It =
+             GetWorld()->GetPlayerControllerIterator();
+         It; ++It) {
+      const APlayerController *PC = It->Get();
+      if (!PC || !PC->IsLocalController())
+        continue;
+
+      FVector ViewLocation;
+      FRotator ViewRotation;
+      PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+      ViewLocations.Add(ViewLocation);
+    }
+
+    for (FRequest &Request : Requests) {
+      const URopeRenderComponent *Rope = Request.Rope.Get();
+      Request.Priority =
+          Request.bLocal || !Rope ? UE_MAX_FLT : GetPriority(*Rope);
+    }
+    Requests.Sort([](const FRequest &A, const FRequest &B) {
+      return A.Priority > B.Priority;
+    });
+
+    for (const FRequest &Request : Requests) {
+      URopeRenderComponent *Rope = Request.Rope.Get();
+      if (!Rope)
+        continue;
+
+      // The local rope never waits; its cost still counts against the others
+      const bool bSimulate =
+          Request.bLocal || Rope->FramesExtrapolated >= MaxExtrapolatedFrames ||
+          Stats.SpentMs + Rope->SimCostMs <= BudgetMs;
+
+      if (!bSimulate) {
+        Rope->StepExtrapolation(Request.DeltaTime);
+        ++Rope->FramesExtrapolated;
+        ++Stats.NumExtrapolated;
+        continue;
+      }
+
+      const uint64 StartCycles = FPlatformTime::Cycles64();
+      Rope->StepSimulation(Request.DeltaTime);
+      const float CostMs = float(FPlatformTime::ToMilliseconds64(
+          FPlatformTime::Cycles64() - StartCycles));
+
+      Rope->SimCostMs =
+          Rope->SimCostMs > 0.f
+              ? FMath::Lerp(Rope->SimCostMs, CostMs, CostSmoothing)
+              : CostMs;
+      Rope->FramesExtrapolated = 0;
+      Stats.SpentMs += CostMs;
+      ++Stats.NumSimulated;
+    }
+
+    Requests.Reset();
+  }
+
+  LastFrameStats = Stats;
+  SET_DWORD_STAT(STAT_RopesSimulated, Stats.NumSimulated);
+  SET_DWORD_STAT(STAT_RopesExtrapolated, Stats.NumExtrapolated);
+  SET_FLOAT_STAT(STAT_RopeSimBudgetUsed, Stats.SpentMs);
+}
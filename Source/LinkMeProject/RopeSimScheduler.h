@@ -0,0 +1,84 @@
+// RopeSimScheduler.h
+// Shares one per-frame time budget between all cosmetic rope simulations
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "RopeSimScheduler.generated.h"
+
+class URopeRenderComponent;
+
+/** What the scheduler did with the last frame's ropes */
+struct FRopeSimFrameStats {
+  int32 NumSimulated = 0;
+  int32 NumExtrapolated = 0;
+  float SpentMs = 0.f;
+};
+
+/**
+ * Caps the cost of rope visuals regardless of how many are in view.
+ *
+ * URopeRenderComponent no longer simulates in its own tick: it queues a
+ * request (after its rope's late update, at its significance tick interval)
+ * and the scheduler runs the queue at the end of the frame. Ropes are taken
+ * by priority - the local player's first, then by screen size, raised for
+ * every frame a rope went without a step - and simulated while the measured
+ * costs fit in BudgetMs. The rest extrapolate their particles from the last
+ * velocities, which is nearly free.
+ *
+ * The local player's rope is always simulated, and no rope extrapolates
+ * more than MaxExtrapolatedFrames frames in a row.
+ *
+ * "stat LinkMe" shows simulated / extrapolated ropes and the budget used.
+ */
+UCLASS(config = Game)
+class LINKMEPROJECT_API URopeSimScheduler : public UTickableWorldSubsystem {
+  GENERATED_BODY()
+
+public:
+  virtual void Deinitialize() override;
+
+  virtual void Tick(float DeltaTime) override;
+  virtual TStatId GetStatId() const override;
+  virtual bool IsTickable() const override;
+
+  /** Queue one step of DeltaTime for this frame (render component tick) */
+  void RequestSimulation(URopeRenderComponent *Rope, float DeltaTime);
+
+  const FRopeSimFrameStats &GetLastFrameStats() const {
+    return LastFrameStats;
+  }
+
+  /** Time all non-local rope simulations may take per frame (ms) */
+  UPROPERTY(config, EditAnywhere, Category = "Rope|Scheduler",
+            meta = (ClampMin = "0.0"))
+  float BudgetMs = 0.5f;
+
+  /** A rope extrapolated this many frames in a row simulates regardless */
+  UPROPERTY(config, EditAnywhere, Category = "Rope|Scheduler",
+            meta = (ClampMin = "1"))
+  int32 MaxExtrapolatedFrames = 8;
+
+protected:
+  virtual bool DoesSupportWorldType(
+      const EWorldType::Type WorldType) const override;
+
+private:
+  struct FRequest {
+    TWeakObjectPtr<URopeRenderComponent> Rope;
+    float DeltaTime = 0.f;
+    float Priority = 0.f;
+    bool bLocal = false;
+  };
+
+  /** Screen size over the closest local view, scaled by starvation */
+  float GetPriority(const URopeRenderComponent &Rope) const;
+
+  TArray<FRequest> Requests;
+
+  /** Scratch view list, reused every frame */
+  TArray<FVector> ViewLocations;
+
+  FRopeSimFrameStats LastFrameStats;
+};
@@ -3,36 +3,131 @@
 #include "RopeSystemComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "DrawDebugHelpers.h"
+#include "Engine/GameInstance.h"
 #include "Engine/World.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/PlayerState.h"
+#include "InputTimestampSubsystem.h"
 #include "Kismet/GameplayStatics.h"
+#include "LinkMeProject.h"
+#include "LinkMeReplicationGraph.h"
+#include "Misc/MemStack.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "Net/UnrealNetwork.h"
 #include "RopeCameraManager.h"
 #include "RopeHookActor.h"
 #include "RopeRenderComponent.h"
+#include "RopeRewindSubsystem.h"
+
+DECLARE_CYCLE_STAT(TEXT("Rope System Tick"), STAT_RopeSystemTick,
+                   STATGROUP_LinkMe);
+DECLARE_CYCLE_STAT(TEXT("Rope Visual Update"), STAT_RopeVisualUpdate,
+                   STATGROUP_LinkMe);
+DECLARE_CYCLE_STAT(TEXT("Rope Late Update"), STAT_RopeLateUpdate,
+                   STATGROUP_LinkMe);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Rope End Correction (cm)"),
+                           STAT_RopeEndCorrection, STATGROUP_LinkMe);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Rope End Offset (cm)"), STAT_RopeEndOffset,
+                           STATGROUP_LinkMe);
+
+void FRopeLateUpdateTickFunction::ExecuteTick(
+    float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread,
+    const FGraphEventRef &MyCompletionGraphEvent) {
+  if (Target && IsValid(Target) && TickType != LEVELTICK_ViewportsOnly) {
+    Target->LateUpdatePlayerEnd();
+  }
+}
+
+FString FRopeLateUpdateTickFunction::DiagnosticMessage() {
+  return Target ? Target->GetFullName() + TEXT("[LateUpdatePlayerEnd]")
+                : TEXT("<NULL>[LateUpdatePlayerEnd]");
+}
 
 URopeSystemComponent::URopeSystemComponent() {
   PrimaryComponentTick.bCanEverTick = true;
   SetIsReplicatedByDefault(true);
+
+  LateUpdateTick.bCanEverTick = true;
+  LateUpdateTick.bStartWithTickEnabled = true;
+  LateUpdateTick.TickGroup = TG_PostPhysics;
+}
+
+void URopeSystemComponent::RegisterComponentTickFunctions(bool bRegister) {
+  Super::RegisterComponentTickFunctions(bRegister);
+
+  if (bRegister) {
+    if (SetupActorComponentTickFunction(&LateUpdateTick)) {
+      LateUpdateTick.Target = this;
+      // Never before this frame's gameplay tick
+      LateUpdateTick.AddPrerequisite(this, PrimaryComponentTick);
+    }
+  } else if (LateUpdateTick.IsTickFunctionRegistered()) {
+    LateUpdateTick.UnRegisterTickFunction();
+  }
 }
 
 void URopeSystemComponent::GetLifetimeReplicatedProps(
     TArray<FLifetimeProperty> &OutLifetimeProps) const {
   Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-  DOREPLIFETIME(URopeSystemComponent, CurrentLength);
-  DOREPLIFETIME(URopeSystemComponent, BendPoints);
-  DOREPLIFETIME(URopeSystemComponent, RopeState);
-  DOREPLIFETIME(URopeSystemComponent, CurrentHook);
+  // Push model: only what a mutation marked dirty is compared
+  FDoRepLifetimeParams Params;
+  Params.bIsPushBased = true;
+  DOREPLIFETIME_WITH_PARAMS_FAST(URopeSystemComponent, CurrentLength, Params);
+  DOREPLIFETIME_WITH_PARAMS_FAST(URopeSystemComponent,
+                                 ReplicatedBendPointAnchors, Params);
+  DOREPLIFETIME_WITH_PARAMS_FAST(URopeSystemComponent, RopeState, Params);
+  DOREPLIFETIME_WITH_PARAMS_FAST(URopeSystemComponent, CurrentHook, Params);
+
+  Params.Condition = COND_SkipOwner;
+  DOREPLIFETIME_WITH_PARAMS_FAST(URopeSystemComponent, PendulumState, Params);
+}
+
+void URopeSystemComponent::PreReplication(
+    IRepChangedPropertyTracker &ChangedPropertyTracker) {
+  Super::PreReplication(ChangedPropertyTracker);
+
+  // An idle rope has nothing to send; the swing only while it stands in for
+  // the pawn's movement
+  const bool bActive = RopeState != ERopeState::Idle;
+  DOREPLIFETIME_ACTIVE_OVERRIDE_FAST(URopeSystemComponent, CurrentLength,
+                                     bActive);
+  DOREPLIFETIME_ACTIVE_OVERRIDE_FAST(
+      URopeSystemComponent, PendulumState,
+      bActive && !GetOwner()->IsReplicatingMovement());
+}
+
+void URopeSystemComponent::SetRopeState(ERopeState NewState) {
+  if (RopeState == NewState)
+    return;
+  RopeState = NewState;
+  MARK_PROPERTY_DIRTY_FROM_NAME(URopeSystemComponent, RopeState, this);
+}
+
+void URopeSystemComponent::SetCurrentLength(float NewLength) {
+  CurrentLength = NewLength;
+  MARK_PROPERTY_DIRTY_FROM_NAME(URopeSystemComponent, CurrentLength, this);
+}
+
+void URopeSystemComponent::SetCurrentHook(ARopeHookActor *NewHook) {
+  CurrentHook = NewHook;
+  MARK_PROPERTY_DIRTY_FROM_NAME(URopeSystemComponent, CurrentHook, this);
 }
 
 void URopeSystemComponent::BeginPlay() {
   Super::BeginPlay();
 
+  bRunCosmetics = LinkMe::ShouldRunCosmetics(GetWorld());
+  if (!bRunCosmetics) {
+    LateUpdateTick.SetTickFunctionEnable(false);
+  }
+
   RenderComponent =
       GetOwner() ? GetOwner()->FindComponentByClass<URopeRenderComponent>()
                  : nullptr;
+  BindRenderComponent();
 
   if (ACharacter *OwnerChar = Cast<ACharacter>(GetOwner())) {
     if (UCharacterMovementComponent *MoveComp =
@@ -60,14 +155,27 @@ void URopeSystemComponent::TickComponent(
     float DeltaTime, enum ELevelTick TickType,
     FActorComponentTickFunction *ThisTickFunction) {
   Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+  SCOPE_CYCLE_COUNTER(STAT_RopeSystemTick);
+
+  // Mutations made by RPCs since the last tick (fire, sever...)
+  FlushReplicatedAnchors();
+
+  // Before anything reads the pawn position
+  if (GetOwner()->HasAuthority()) {
+    UpdateSwingReplicationMode();
+  } else {
+    UpdateRemoteSwing(DeltaTime);
+  }
 
-  // Lightweight visual updates only
   // Lightweight visual updates only
   // FIXED: Must tick if RenderComponent is active to allow hiding it
   bool bIsVisualActive = RenderComponent && RenderComponent->IsRopeActive();
   if (RopeState == ERopeState::Idle && !bIsVisualActive)
     return;
 
+  // Moving platforms + player end, resolved once for everything below
+  ResolveBendPointPositions();
+
   // --- REFACTORED FOR BP API ---
   if (GetOwner()->HasAuthority()) {
     if (RopeState == ERopeState::Flying && CurrentHook) {
@@ -114,9 +222,30 @@ void URopeSystemComponent::TickComponent(
 
       // Apex Window Detection
       UpdateApexDetection(DeltaTime);
+
+      if (!GetOwner()->IsReplicatingMovement()) {
+        CapturePendulumState();
+      }
+    }
+  } else if (RopeState == ERopeState::Attached) {
+    // The owning client grades its own SwingJump input, so it predicts the
+    // apex window locally as well
+    const APawn *OwnerPawn = Cast<APawn>(GetOwner());
+    if (OwnerPawn && OwnerPawn->IsLocallyControlled()) {
+      UpdateApexDetection(DeltaTime);
+    }
+
+    // Same wrap logic as the server, on the locally predicted position
+    if (IsPredictingWraps()) {
+      OnRopeTickAttached(DeltaTime);
+      UpdateWrapPrediction(DeltaTime);
+    } else if (IsRemoteRope()) {
+      UpdateRemoteInterpolation();
     }
   }
 
+  FlushReplicatedAnchors();
+
   // Visual update (client + server)
   UpdateRopeVisual();
 }
@@ -139,6 +268,19 @@ void URopeSystemComponent::PerformPhysics(float DeltaTime) {
 }
 
 void URopeSystemComponent::OnRep_BendPoints() {
+  if (IsPredictingWraps() && ReplicatedBendPointAnchors.Num() >= 2) {
+    // Owning client: merge with what it already predicted
+    ReconcilePredictedBendPoints();
+  } else {
+    BendPointAnchors = ReplicatedBendPointAnchors;
+    RebuildBendPointsFromAnchors();
+
+    // Other players' ropes are drawn slightly in the past, between updates
+    if (IsRemoteRope()) {
+      PushRemoteSnapshot();
+    }
+  }
+
   // Force update the visual component when the server sends new topology
   UpdateRopeVisual();
 }
@@ -151,36 +293,30 @@ void URopeSystemComponent::ReelInToFirstBendPoint() {
   if (!CurrentHook || BendPoints.Num() == 0)
     return;
 
-  // 1. Stop projectile movement
-  if (CurrentHook->ProjectileMovement) {
-    CurrentHook->ProjectileMovement->StopMovementImmediately();
-    CurrentHook->ProjectileMovement->Deactivate();
-  }
-
-  // 2. Get anchor position (first bendpoint created during flying wrap)
+  // 1. Get anchor position (first bendpoint created during flying wrap)
   FVector AnchorPos = BendPoints[0];
+  UPrimitiveComponent *AnchorComponent =
+      BendPointAnchors.IsValidIndex(0) ? BendPointAnchors[0].Component.Get()
+                                       : nullptr;
 
-  // 2.5 Update Rope Length to prevent physics snap
+  // 2. Update Rope Length to prevent physics snap
   // We set the rope length to the current distance so it doesn't instantly pull
   // the player
   float NewLength = FVector::Dist(AnchorPos, GetOwner()->GetActorLocation());
-  CurrentLength = NewLength;
+  SetCurrentLength(NewLength);
 
-  // 3. Teleport hook to anchor
-  CurrentHook->SetActorLocation(AnchorPos);
+  // 3. Stop the flight and teleport hook to anchor (replicated to clients)
+  CurrentHook->LandAt(AnchorPos, AnchorComponent);
 
   // 4. Clear flying bendpoints
-  BendPoints.Empty();
-  BendPointNormals.Empty();
+  ClearBendPoints();
 
   // 5. Transition to Attached state
-  RopeState = ERopeState::Attached;
+  SetRopeState(ERopeState::Attached);
 
   // 6. Initialize attached bendpoints array [Anchor, Player]
-  BendPoints.Add(AnchorPos);
-  BendPoints.Add(GetOwner()->GetActorLocation());
-  BendPointNormals.Add(FVector::UpVector);
-  BendPointNormals.Add(FVector::UpVector);
+  InsertBendPointInternal(0, AnchorPos, FVector::UpVector, AnchorComponent);
+  InsertBendPointInternal(1, GetOwner()->GetActorLocation(), FVector::UpVector);
 
   // Debug
   if (bShowDebug) {
@@ -190,17 +326,48 @@ void URopeSystemComponent::ReelInToFirstBendPoint() {
   }
 }
 
+double URopeSystemComponent::GetClientViewTime() const {
+  const UWorld *World = GetWorld();
+  const AGameStateBase *GameState = World->GetGameState();
+  if (!GameState)
+    return World->GetTimeSeconds();
+
+  double ViewTime = GameState->GetServerWorldTimeSeconds();
+
+  // Remote actors on screen are about one one-way trip behind the server
+  if (!GetOwner()->HasAuthority()) {
+    if (const APawn *Pawn = Cast<APawn>(GetOwner())) {
+      if (const APlayerState *PlayerState = Pawn->GetPlayerState()) {
+        ViewTime -= PlayerState->GetPingInMilliseconds() * 0.0005;
+      }
+    }
+  }
+  return ViewTime;
+}
+
+float URopeSystemComponent::GetRewindLatency(double ClientFireTime) const {
+  const URopeRewindSubsystem *Rewind =
+      GetWorld()->GetSubsystem<URopeRewindSubsystem>();
+  if (!Rewind || !Rewind->IsTickable())
+    return 0.f;
+
+  // Never rewind past the history, nor into the future
+  const double Latency = GetWorld()->GetTimeSeconds() - ClientFireTime;
+  return FMath::Clamp(static_cast<float>(Latency), 0.f,
+                      Rewind->MaxRewindTime);
+}
+
 void URopeSystemComponent::FireHook(const FVector &Direction) {
   if (!GetOwner()->HasAuthority()) {
-    ServerFireHook(Direction);
+    ServerFireHook(Direction, GetClientViewTime());
     // Optional: Client prediction here (spawn fake hook)
     return;
   }
-  ServerFireHook(Direction);
+  ServerFireHook(Direction, GetClientViewTime());
 }
 
 void URopeSystemComponent::ServerFireHook_Implementation(
-    const FVector &Direction) {
+    const FVector &Direction, double ClientFireTime) {
   if (!HookClass || !GetWorld()) {
     UE_LOG(LogTemp, Error, TEXT("FireHook: HookClass or World is null"));
     return;
@@ -215,13 +382,13 @@ void URopeSystemComponent::ServerFireHook_Implementation(
   // --- Reset Existing Rope Logic ---
   if (CurrentHook) {
     CurrentHook->Destroy();
-    CurrentHook = nullptr;
+    SetCurrentHook(nullptr);
   }
   if (RenderComponent) {
     RenderComponent->ResetRope();
   }
-  BendPoints.Reset();
-  RopeState = ERopeState::Idle;
+  ClearBendPoints();
+  SetRopeState(ERopeState::Idle);
   // ---------------------------------
 
   FVector SpawnLocation = Owner->GetActorLocation() + Direction * 50.f;
@@ -247,9 +414,9 @@ void URopeSystemComponent::ServerFireHook_Implementation(
   Params.SpawnCollisionHandlingOverride =
       ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
 
-  CurrentHook = GetWorld()->SpawnActorDeferred<ARopeHookActor>(
+  SetCurrentHook(GetWorld()->SpawnActorDeferred<ARopeHookActor>(
       HookClass, FTransform(SpawnRotation, SpawnLocation), Owner,
-      Cast<APawn>(Owner), ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+      Cast<APawn>(Owner), ESpawnActorCollisionHandlingMethod::AlwaysSpawn));
 
   if (CurrentHook) {
     // PRE-INIT CONFIGURATION (CRITICAL FOR COLLISION IGNORE)
@@ -268,23 +435,19 @@ void URopeSystemComponent::ServerFireHook_Implementation(
       }
     }
 
-    // Note: ProjectileMovement might verify updated component overlaps on init,
-    // so setting ignores on the actor/root first is key. The explicit
-    // MoveIgnoreActors on ProjectileMovement component must be done after
-    // component creation but before activation if possible. However,
-    // ProjectileMovement is created in constructor. We can't easily access the
-    // component here without including the projectile header, but we can rely
-    // on the Actor-level ignore we just set on the root.
+    // Note: the hook copies the root's move-ignore lists into its flight
+    // query params when fired, so they must be set before Fire().
 
     // Finish Spawning
     UGameplayStatics::FinishSpawningActor(
         CurrentHook, FTransform(SpawnRotation, SpawnLocation));
 
+    CurrentHook->SetRewindLatency(GetRewindLatency(ClientFireTime));
     CurrentHook->Fire(Direction);
 
     CurrentHook->OnHookImpact.AddDynamic(this,
                                          &URopeSystemComponent::OnHookImpact);
-    RopeState = ERopeState::Flying;
+    SetRopeState(ERopeState::Flying);
 
     if (bShowDebug) {
       UE_LOG(LogTemp, Log, TEXT("Hook fired successfully (Server)"));
@@ -297,14 +460,14 @@ void URopeSystemComponent::ServerFireHook_Implementation(
 
 void URopeSystemComponent::FireChargedHook(const FVector &Velocity) {
   if (!GetOwner()->HasAuthority()) {
-    ServerFireChargedHook(Velocity);
+    ServerFireChargedHook(Velocity, GetClientViewTime());
     return;
   }
-  ServerFireChargedHook(Velocity);
+  ServerFireChargedHook(Velocity, GetClientViewTime());
 }
 
 void URopeSystemComponent::ServerFireChargedHook_Implementation(
-    const FVector &Velocity) {
+    const FVector &Velocity, double ClientFireTime) {
   UE_LOG(LogTemp, Warning,
          TEXT("URopeSystemComponent::ServerFireChargedHook called with "
               "Velocity: %s"),
@@ -327,12 +490,12 @@ void URopeSystemComponent::ServerFireChargedHook_Implementation(
   // Reset Logic
   if (CurrentHook) {
     CurrentHook->Destroy();
-    CurrentHook = nullptr;
+    SetCurrentHook(nullptr);
   }
   if (RenderComponent)
     RenderComponent->ResetRope();
-  BendPoints.Reset();
-  RopeState = ERopeState::Idle;
+  ClearBendPoints();
+  SetRopeState(ERopeState::Idle);
 
   // Spawn
   // Use a safer offset to avoid initial overlap (Capsule Radius is usually
@@ -345,13 +508,14 @@ void URopeSystemComponent::ServerFireChargedHook_Implementation(
   Params.Owner = Owner;
   Params.Instigator = Cast<APawn>(Owner);
 
-  CurrentHook = GetWorld()->SpawnActor<ARopeHookActor>(HookClass, SpawnLocation,
-                                                       SpawnRotation, Params);
+  SetCurrentHook(GetWorld()->SpawnActor<ARopeHookActor>(
+      HookClass, SpawnLocation, SpawnRotation, Params));
   if (CurrentHook) {
+    CurrentHook->SetRewindLatency(GetRewindLatency(ClientFireTime));
     CurrentHook->FireVelocity(Velocity);
     CurrentHook->OnHookImpact.AddDynamic(this,
                                          &URopeSystemComponent::OnHookImpact);
-    RopeState = ERopeState::Flying;
+    SetRopeState(ERopeState::Flying);
 
     if (bShowDebug) {
       if (GEngine)
@@ -384,6 +548,35 @@ void URopeSystemComponent::Sever() {
 }
 
 void URopeSystemComponent::SwingJump(float BaseBoostMultiplier) {
+  // Called from the Blueprint input handler: still within the input pump
+  SwingJumpAtTime(BaseBoostMultiplier, GetInputTimeSeconds());
+}
+
+double URopeSystemComponent::GetInputTimeSeconds() const {
+  const UWorld *World = GetWorld();
+  if (!World)
+    return 0.0;
+
+  if (const UGameInstance *GameInstance = World->GetGameInstance()) {
+    if (const UInputTimestampSubsystem *Stamps =
+            GameInstance->GetSubsystem<UInputTimestampSubsystem>()) {
+      const double PressTime = Stamps->GetPressWorldTime(World);
+      if (PressTime >= 0.0)
+        return PressTime;
+    }
+  }
+
+  // World time already covers this frame; the press came during it
+  return World->GetTimeSeconds() - 0.5 * World->GetDeltaSeconds();
+}
+
+void URopeSystemComponent::SwingJumpAtTime(float BaseBoostMultiplier,
+                                           double InputTimeSeconds) {
+  // Same press already handled (native binding and Blueprint event)
+  if (LastSwingJumpFrame == GFrameCounter)
+    return;
+  LastSwingJumpFrame = GFrameCounter;
+
   // Only works when attached (swinging)
   if (RopeState != ERopeState::Attached) {
     // Fallback to normal sever if not swinging
@@ -396,9 +589,26 @@ void URopeSystemComponent::SwingJump(float BaseBoostMultiplier) {
   EApexTier Tier = EApexTier::None;
   float BoostPercent = 0.f;
 
-  if (bIsInApexWindow) {
+  // Graded against the analytic window, not a tick-accumulated timer, so the
+  // same input time gives the same tier at any frame rate. A press stamped
+  // before the close may be handled after the next window was predicted.
+  const auto InWindow = [InputTimeSeconds](double Open, double Close) {
+    return Open >= 0.0 && InputTimeSeconds >= Open &&
+           InputTimeSeconds <= Close;
+  };
+  double WindowOpenTime = -1.0;
+  if (InWindow(ApexWindowOpenTime, ApexWindowCloseTime)) {
+    WindowOpenTime = ApexWindowOpenTime;
+  } else if (InWindow(LastApexWindowOpenTime, LastApexWindowCloseTime)) {
+    WindowOpenTime = LastApexWindowOpenTime;
+  }
+
+  if (WindowOpenTime >= 0.0) {
     // Calculate progress through window (0 = just entered, 1 = end of window)
-    float Progress = FMath::Clamp(ApexWindowTimer / ApexFrameTime, 0.f, 1.f);
+    float Progress = FMath::Clamp(
+        static_cast<float>((InputTimeSeconds - WindowOpenTime) /
+                           FMath::Max(ApexFrameTime, KINDA_SMALL_NUMBER)),
+        0.f, 1.f);
 
     // Get curve-based boost (if curve exists)
     float CurveValue = 1.f;
@@ -468,84 +678,150 @@ void URopeSystemComponent::SwingJump(float BaseBoostMultiplier) {
   OnApexJump_Client(Tier);
 
   // Reset apex state
-  bIsInApexWindow = false;
-  ApexWindowTimer = 0.f;
+  ResetApexWindow();
 
   // Then sever
   Sever();
 }
 
+namespace {
+/**
+ * Times t where Height + VelZ * t - 0.5 * Gravity * t^2 == Target.
+ * Near the apex window the rope is close to horizontal, so gravity is almost
+ * entirely tangential and the vertical motion is ballistic: the v^2 budget
+ * (energy) decides whether and when a height is reached.
+ */
+bool SolveApexCrossing(float Height, float VelZ, float Gravity, float Target,
+                       float &OutEarly, float &OutLate) {
+  const float Discriminant =
+      VelZ * VelZ - 2.f * Gravity * (Target - Height);
+  if (Discriminant < 0.f)
+    return false;
+  const float Root = FMath::Sqrt(Discriminant);
+  OutEarly = (VelZ - Root) / Gravity;
+  OutLate = (VelZ + Root) / Gravity;
+  return true;
+}
+
+/** First strictly future crossing of Target, or -1 if never reached */
+float FirstFutureCrossing(float Height, float VelZ, float Gravity,
+                          float Target) {
+  float Early, Late;
+  if (!SolveApexCrossing(Height, VelZ, Gravity, Target, Early, Late))
+    return -1.f;
+  return Early > 0.f ? Early : (Late > 0.f ? Late : -1.f);
+}
+} // namespace
+
+void URopeSystemComponent::ResetApexWindow() {
+  bIsInApexWindow = false;
+  bIsInApexBand = false;
+  ApexWindowOpenTime = -1.0;
+  ApexWindowCloseTime = -1.0;
+  LastApexWindowOpenTime = -1.0;
+  LastApexWindowCloseTime = -1.0;
+}
+
+bool URopeSystemComponent::GetPredictedApexWindow(double &OutOpenTime,
+                                                  double &OutCloseTime) const {
+  OutOpenTime = ApexWindowOpenTime;
+  OutCloseTime = ApexWindowCloseTime;
+  return ApexWindowOpenTime >= 0.0;
+}
+
 void URopeSystemComponent::UpdateApexDetection(float DeltaTime) {
   if (RopeState != ERopeState::Attached) {
-    bIsInApexWindow = false;
-    ApexWindowTimer = 0.f;
+    ResetApexWindow();
     return;
   }
 
   ACharacter *OwnerChar = Cast<ACharacter>(GetOwner());
-  if (!OwnerChar)
+  UCharacterMovementComponent *MoveComp =
+      OwnerChar ? OwnerChar->GetCharacterMovement() : nullptr;
+  if (!MoveComp || !GetWorld())
     return;
 
-  // Calculate swing arc position (0 = bottom, 0.5 = top/apex, 1 = bottom again)
-  // Use normalized height relative to anchor point
+  const double Now = GetWorld()->GetTimeSeconds();
+
+  // The player swings around the last fixed point, on whatever rope is left
+  // after the fixed spans and windings
   FVector PlayerPos = OwnerChar->GetActorLocation();
-  FVector AnchorPos =
-      (BendPoints.Num() > 0)
-          ? BendPoints[0]
-          : (CurrentHook ? CurrentHook->GetActorLocation() : PlayerPos);
-
-  float VerticalDiff = PlayerPos.Z - AnchorPos.Z;
-  float RopeLen = FMath::Max(CurrentLength, 1.f);
-
-  // Normalize: -1 (at anchor) to +1 (below anchor by rope length)
-  // Then convert to 0-1 arc position: 0 = lowest, 0.5 = apex (at anchor level),
-  // 1 = lowest
-  float NormalizedHeight = FMath::Clamp(VerticalDiff / RopeLen, -1.f, 1.f);
-
-  // Convert to arc position: when player is at anchor height
-  // (NormalizedHeight=0), that's apex (0.5) When below anchor, going up: 0 ->
-  // 0.5 When below anchor, going down: 0.5 -> 1
-  float ArcPosition = 0.5f - (NormalizedHeight * 0.5f);
-
-  // Check if in apex window based on arc position
-  bool bShouldBeInWindow =
-      (ArcPosition >= SwingArcApexStart && ArcPosition <= SwingArcApexEnd);
-
-  if (bShouldBeInWindow) {
-    if (!bIsInApexWindow) {
-      // Enter apex window
-      bIsInApexWindow = true;
-      ApexWindowTimer = 0.f;
+  RefreshGeometryCache();
+  FVector AnchorPos = GeometryCache.GetLastFixedPoint(
+      CurrentHook ? CurrentHook->GetActorLocation() : PlayerPos);
+
+  float RopeLen =
+      FMath::Max(CurrentLength - GeometryCache.GetFixedLength() -
+                     GeometryCache.GetWrappedLength(),
+                 1.f);
+
+  // Arc position is 0.5 - 0.5 * Height / RopeLen (0.5 = anchor level), so
+  // the [SwingArcApexStart, SwingArcApexEnd] window is a height band
+  const float BandLow = (0.5f - SwingArcApexEnd) * 2.f * RopeLen;
+  const float BandHigh = (0.5f - SwingArcApexStart) * 2.f * RopeLen;
+  const float Height =
+      FMath::Clamp(PlayerPos.Z - AnchorPos.Z, -RopeLen, RopeLen);
+  const float VelZ = MoveComp->Velocity.Z;
+  const float Gravity = FMath::Max(FMath::Abs(MoveComp->GetGravityZ()), 1.f);
+
+  const bool bInBand = Height >= BandLow && Height <= BandHigh;
+
+  if (bInBand) {
+    if (!bIsInApexBand) {
+      // Entered since last tick: solve back for the crossing instead of
+      // stamping the window with this tick's time
+      const float Boundary = (VelZ >= 0.f) ? BandLow : BandHigh;
+      float Early, Late, Since = 0.f;
+      if (SolveApexCrossing(Height, VelZ, Gravity, Boundary, Early, Late)) {
+        const float LastPast = (Late <= 0.f) ? Late : Early;
+        Since = FMath::Clamp(-LastPast, 0.f, DeltaTime);
+      }
+      ApexWindowOpenTime = Now - Since;
 
       if (bShowDebug && GEngine) {
         GEngine->AddOnScreenDebugMessage(
             -1, 0.5f, FColor::Magenta,
-            FString::Printf(TEXT("APEX WINDOW OPEN (Arc: %.2f)"), ArcPosition));
-      }
-    } else {
-      // Continue in window
-      ApexWindowTimer += DeltaTime;
-      if (ApexWindowTimer > ApexFrameTime) {
-        // Exit window (timed out)
-        bIsInApexWindow = false;
-        if (bShowDebug && GEngine) {
-          GEngine->AddOnScreenDebugMessage(
-              -1, 0.5f, FColor::Red, TEXT("Apex window closed (timeout)"));
-        }
+            FString::Printf(TEXT("APEX WINDOW OPEN (%.1f ms ago)"),
+                            Since * 1000.f));
       }
     }
+
+    // Close on timeout or when the swing leaves the band, whichever is first
+    ApexWindowCloseTime = ApexWindowOpenTime + ApexFrameTime;
+    const float ToHigh = FirstFutureCrossing(Height, VelZ, Gravity, BandHigh);
+    const float ToLow = FirstFutureCrossing(Height, VelZ, Gravity, BandLow);
+    const float ToExit = (ToHigh > 0.f && ToLow > 0.f)
+                             ? FMath::Min(ToHigh, ToLow)
+                             : FMath::Max(ToHigh, ToLow);
+    if (ToExit > 0.f) {
+      ApexWindowCloseTime = FMath::Min(ApexWindowCloseTime, Now + ToExit);
+    }
   } else {
-    // Exit window (outside arc range)
-    if (bIsInApexWindow) {
-      bIsInApexWindow = false;
-      if (bShowDebug && GEngine) {
-        GEngine->AddOnScreenDebugMessage(
-            -1, 0.5f, FColor::Orange,
-            FString::Printf(TEXT("Apex window closed (Arc: %.2f)"),
-                            ArcPosition));
-      }
+    if (bIsInApexBand && bShowDebug && GEngine) {
+      GEngine->AddOnScreenDebugMessage(-1, 0.5f, FColor::Orange,
+                                       TEXT("Apex window closed (left arc)"));
+    }
+
+    // The window that just closed stays gradable for late-handled presses
+    if (ApexWindowOpenTime >= 0.0 && ApexWindowOpenTime <= Now) {
+      LastApexWindowOpenTime = ApexWindowOpenTime;
+      LastApexWindowCloseTime = ApexWindowCloseTime;
+    }
+
+    // Predict the next entry from the side we are approaching
+    const float Boundary = (Height < BandLow) ? BandLow : BandHigh;
+    const float ToEnter = FirstFutureCrossing(Height, VelZ, Gravity, Boundary);
+    if (ToEnter > 0.f) {
+      ApexWindowOpenTime = Now + ToEnter;
+      ApexWindowCloseTime = ApexWindowOpenTime + ApexFrameTime;
+    } else {
+      ApexWindowOpenTime = -1.0;
+      ApexWindowCloseTime = -1.0;
     }
   }
+
+  bIsInApexBand = bInBand;
+  bIsInApexWindow = bInBand && Now <= ApexWindowCloseTime;
 }
 
 EApexTier
@@ -571,7 +847,7 @@ void URopeSystemComponent::Detach() {
     CurrentHook->SetLifeSpan(3.0f);
 
     // 4. Forget about it
-    CurrentHook = nullptr;
+    SetCurrentHook(nullptr);
   }
 
   // 5. Normal cleanup for player side
@@ -579,10 +855,9 @@ void URopeSystemComponent::Detach() {
     RenderComponent->ResetRope();
   }
 
-  BendPoints.Reset();
-  BendPointNormals.Reset();
-  CurrentLength = 0.f;
-  RopeState = ERopeState::Idle;
+  ClearBendPoints();
+  SetCurrentLength(0.f);
+  SetRopeState(ERopeState::Idle);
 
   // No need to reset movement physics here as we were likely flying (AIR)
   // anyway, but good safety to ensure camera reset if we were somehow attached.
@@ -597,17 +872,16 @@ void URopeSystemComponent::Detach() {
 void URopeSystemComponent::ServerSever_Implementation() {
   if (CurrentHook) {
     CurrentHook->Destroy();
-    CurrentHook = nullptr;
+    SetCurrentHook(nullptr);
   }
 
   if (RenderComponent) {
     RenderComponent->ResetRope();
   }
 
-  BendPoints.Reset();
-  BendPointNormals.Reset(); // Keep normals array in sync
-  CurrentLength = 0.f;
-  RopeState = ERopeState::Idle;
+  ClearBendPoints();
+  SetCurrentLength(0.f);
+  SetRopeState(ERopeState::Idle);
 
   // Restore movement settings
   if (ACharacter *OwnerChar = Cast<ACharacter>(GetOwner())) {
@@ -636,7 +910,7 @@ void URopeSystemComponent::ReelIn(float DeltaTime) {
 }
 
 void URopeSystemComponent::ServerReelIn_Implementation(float DeltaTime) {
-  CurrentLength = FMath::Max(0.f, CurrentLength - ReelSpeed * DeltaTime);
+  SetCurrentLength(FMath::Max(0.f, CurrentLength - ReelSpeed * DeltaTime));
 }
 
 void URopeSystemComponent::ReelOut(float DeltaTime) {
@@ -648,7 +922,8 @@ void URopeSystemComponent::ReelOut(float DeltaTime) {
 }
 
 void URopeSystemComponent::ServerReelOut_Implementation(float DeltaTime) {
-  CurrentLength = FMath::Min(MaxLength, CurrentLength + ReelSpeed * DeltaTime);
+  SetCurrentLength(
+      FMath::Min(MaxLength, CurrentLength + ReelSpeed * DeltaTime));
 }
 
 // ===================================================================
@@ -662,10 +937,24 @@ void URopeSystemComponent::AddBendPoint(const FVector &Location) {
 
 void URopeSystemComponent::AddBendPointWithNormal(
     const FVector &Location, const FVector &SurfaceNormal) {
+  // BP wrap logic computes the point from a CapsuleSweepBetween hit: if it is
+  // next to that hit, ride on the same component
+  UPrimitiveComponent *Component = nullptr;
+  if (LastSweepComponent.IsValid() &&
+      FVector::DistSquared(Location, LastSweepImpactPoint) <
+          FMath::Square(SweepComponentMatchDistance)) {
+    Component = LastSweepComponent.Get();
+  }
+  AddBendPointOnComponent(Location, SurfaceNormal, Component);
+}
+
+void URopeSystemComponent::AddBendPointOnComponent(
+    const FVector &Location, const FVector &SurfaceNormal,
+    UPrimitiveComponent *Component) {
   // FLYING STATE: BendPoints may be empty, just append to end
   if (RopeState == ERopeState::Flying) {
-    BendPoints.Add(Location);
-    BendPointNormals.Add(SurfaceNormal);
+    InsertBendPointInternal(BendPoints.Num(), Location, SurfaceNormal,
+                            Component);
 
     if (bShowDebug) {
       DrawDebugSphere(GetWorld(), Location, 12, 12, FColor::Yellow, false, 2.f);
@@ -674,6 +963,15 @@ void URopeSystemComponent::AddBendPointWithNormal(
       UE_LOG(LogTemp, Log, TEXT("FLYING WRAP: Added bendpoint at %s"),
              *Location.ToString());
     }
+
+    // Order is Player -> Hook and neither end is stored, so every point with
+    // two stored neighbours can be dropped
+    if (!EnforceBendPointBudget(1, BendPoints.Num() - 2)) {
+      RemoveBendPointInternal(BendPoints.Num() - 1);
+      if (bShowDebug) {
+        UE_LOG(LogTemp, Log, TEXT("FLYING WRAP: Budget full, wrap refused"));
+      }
+    }
     return;
   }
 
@@ -684,19 +982,9 @@ void URopeSystemComponent::AddBendPointWithNormal(
     return;
   }
 
-  // CRITICAL: Ensure normals array is same size as positions array
-  // This handles the case where rope was initialized before this function was
-  // implemented
-  while (BendPointNormals.Num() < BendPoints.Num()) {
-    BendPointNormals.Add(FVector::UpVector); // Fill with default normals
-  }
-
   // Insert position before the last element (player position)
   const int32 InsertIndex = BendPoints.Num() - 1;
-  BendPoints.Insert(Location, InsertIndex);
-
-  // Keep normals array in sync - now safe because we ensured same size
-  BendPointNormals.Insert(SurfaceNormal, InsertIndex);
+  InsertBendPointInternal(InsertIndex, Location, SurfaceNormal, Component);
 
   if (bShowDebug) {
     DrawDebugSphere(GetWorld(), Location, 12, 12, FColor::Green, false, 2.f);
@@ -705,6 +993,8 @@ void URopeSystemComponent::AddBendPointWithNormal(
     UE_LOG(LogTemp, Log, TEXT("WRAP: Added bendpoint at %s with normal %s"),
            *Location.ToString(), *SurfaceNormal.ToString());
   }
+
+  SimplifyAfterInsert(InsertIndex);
 }
 
 void URopeSystemComponent::RemoveBendPointAt(int32 Index) {
@@ -721,18 +1011,895 @@ void URopeSystemComponent::RemoveBendPointAt(int32 Index) {
     return;
   }
 
-  BendPoints.RemoveAt(Index);
+  // A wound corner unwinds one loop at a time instead of disappearing
+  if (BendPointWindings.IsValidIndex(Index) &&
+      BendPointWindings[Index].Count > 0) {
+    FRopeWinding &Winding = BendPointWindings[Index];
+    const float LoopLength = Winding.WrappedLength / Winding.Count;
+    Winding.Count--;
+    Winding.WrappedLength =
+        Winding.Count > 0 ? Winding.WrappedLength - LoopLength : 0.f;
+    TotalWrappedLength = FMath::Max(0.f, TotalWrappedLength - LoopLength);
 
-  // Keep normals array in sync
-  if (BendPointNormals.IsValidIndex(Index)) {
-    BendPointNormals.RemoveAt(Index);
+    if (bShowDebug) {
+      UE_LOG(LogTemp, Log,
+             TEXT("UNWRAP: Unwound one loop at index %d (%d left, %.1f cm)"),
+             Index, Winding.Count, Winding.WrappedLength);
+    }
+    return;
   }
 
+  RemoveBendPointInternal(Index);
+
   if (bShowDebug) {
     UE_LOG(LogTemp, Log, TEXT("UNWRAP: Removed bendpoint at index %d"), Index);
   }
 }
 
+int32 URopeSystemComponent::GetWindingCount() const {
+  int32 Total = 0;
+  for (const FRopeWinding &Winding : BendPointWindings) {
+    Total += Winding.Count;
+  }
+  return Total;
+}
+
+// ===================================================================
+// REMOTE ROPE SMOOTHING (simulated proxies)
+// ===================================================================
+
+bool URopeSystemComponent::IsRemoteRope() const {
+  if (!bRunCosmetics || RemoteInterpolationDelay <= 0.f)
+    return false;
+
+  const APawn *OwnerPawn = Cast<APawn>(GetOwner());
+  return OwnerPawn && !OwnerPawn->HasAuthority() &&
+         !OwnerPawn->IsLocallyControlled();
+}
+
+void URopeSystemComponent::PushRemoteSnapshot() {
+  const TArray<FRopeBendPointAnchor> &Anchors = ReplicatedBendPointAnchors;
+  if (RopeState != ERopeState::Attached || Anchors.Num() < 2) {
+    RemoteSnapshots.Reset();
+    bUseRemotePoints = false;
+    return;
+  }
+
+  // A new rope shares nothing with the previous one: no blending across
+  if (RemoteSnapshots.Num() > 0 &&
+      RemoteSnapshots.Last().Anchors[0].Id != Anchors[0].Id) {
+    RemoteSnapshots.Reset();
+  }
+
+  // Bounded even if updates arrive faster than the render time advances
+  constexpr int32 MaxRemoteSnapshots = 16;
+  const double Now = GetWorld()->GetTimeSeconds();
+
+  // Topology only replicates when it changes, so after a quiet period the
+  // last snapshot can be seconds old and blending from it would put most of
+  // the change in at once. Hold it at the current render time instead: the
+  // change then blends over the whole delay.
+  const double HoldTime = Now - RemoteInterpolationDelay;
+  if (RemoteSnapshots.Num() > 0 && RemoteSnapshots.Last().Time < HoldTime) {
+    RemoteSnapshots.RemoveAt(0, RemoteSnapshots.Num() - 1);
+    RemoteSnapshots[0].Time = HoldTime;
+  }
+  if (RemoteSnapshots.Num() > 0 && RemoteSnapshots.Last().Time >= Now) {
+    RemoteSnapshots.Last().Anchors = Anchors;
+  } else {
+    if (RemoteSnapshots.Num() >= MaxRemoteSnapshots) {
+      RemoteSnapshots.RemoveAt(0);
+    }
+    FRemoteSnapshot &Snapshot = RemoteSnapshots.AddDefaulted_GetRef();
+    Snapshot.Time = Now;
+    Snapshot.Anchors = Anchors;
+  }
+
+  UpdateRemoteInterpolation();
+}
+
+void URopeSystemComponent::UpdateRemoteInterpolation() {
+  if (RemoteSnapshots.Num() == 0) {
+    bUseRemotePoints = false;
+    return;
+  }
+
+  const double RenderTime =
+      GetWorld()->GetTimeSeconds() - RemoteInterpolationDelay;
+
+  // Keep exactly one snapshot at or before the render time
+  while (RemoteSnapshots.Num() >= 2 && RemoteSnapshots[1].Time <= RenderTime) {
+    RemoteSnapshots.RemoveAt(0);
+  }
+
+  // The player end is the pawn as it is drawn now, never the stale server
+  // entry
+  const FVector PlayerPosition = GetOwner()->GetActorLocation();
+  const FRemoteSnapshot &Older = RemoteSnapshots[0];
+  const TArray<FRopeBendPointAnchor> &From = Older.Anchors;
+  RemotePoints.Reset();
+  bUseRemotePoints = true;
+
+  if (RemoteSnapshots.Num() == 1 || RenderTime <= Older.Time) {
+    for (int32 i = 0; i < From.Num() - 1; ++i) {
+      RemotePoints.Add(From[i].Resolve());
+    }
+    RemotePoints.Add(PlayerPosition);
+    return;
+  }
+
+  const FRemoteSnapshot &Newer = RemoteSnapshots[1];
+  const TArray<FRopeBendPointAnchor> &To = Newer.Anchors;
+  const float Alpha = FMath::Clamp(
+      float((RenderTime - Older.Time) / (Newer.Time - Older.Time)), 0.f, 1.f);
+
+  // Union of both topologies in rope order (fixed points only). Points
+  // present in both keep their relative order, so matches are searched
+  // forward only.
+  struct FRemotePoint {
+    FVector From = FVector::ZeroVector;
+    FVector To = FVector::ZeroVector;
+    bool bInFrom = false;
+    bool bInTo = false;
+  };
+  TRopeScratchArray<FRemotePoint> Points;
+
+  auto AddLeaving = [&](int32 Index) {
+    FRemotePoint &Point = Points.AddDefaulted_GetRef();
+    Point.From = From[Index].Resolve();
+    Point.bInFrom = true;
+  };
+
+  const int32 NumFromFixed = From.Num() - 1;
+  int32 NextFrom = 0;
+  for (int32 j = 0; j < To.Num() - 1; ++j) {
+    int32 Match = INDEX_NONE;
+    for (int32 i = NextFrom; i < NumFromFixed && To[j].Id != 0; ++i) {
+      if (From[i].Id == To[j].Id) {
+        Match = i;
+        break;
+      }
+    }
+
+    if (Match != INDEX_NONE) {
+      for (int32 i = NextFrom; i < Match; ++i) {
+        AddLeaving(i);
+      }
+      NextFrom = Match + 1;
+    }
+
+    FRemotePoint &Point = Points.AddDefaulted_GetRef();
+    Point.To = To[j].Resolve();
+    Point.bInTo = true;
+    if (Match != INDEX_NONE) {
+      Point.From = From[Match].Resolve();
+      Point.bInFrom = true;
+    }
+  }
+  for (int32 i = NextFrom; i < NumFromFixed; ++i) {
+    AddLeaving(i);
+  }
+
+  // Neighbours of Index that exist on one side; a missing previous one
+  // (e.g. reeled-in anchor) collapses the segment onto the next
+  auto GetNeighbours = [&](int32 Index, bool bFromSide, FVector &OutPrev,
+                           FVector &OutNext) {
+    OutNext = PlayerPosition;
+    for (int32 k = Index + 1; k < Points.Num(); ++k) {
+      if (bFromSide ? Points[k].bInFrom : Points[k].bInTo) {
+        OutNext = bFromSide ? Points[k].From : Points[k].To;
+        break;
+      }
+    }
+    OutPrev = OutNext;
+    for (int32 k = Index - 1; k >= 0; --k) {
+      if (bFromSide ? Points[k].bInFrom : Points[k].bInTo) {
+        OutPrev = bFromSide ? Points[k].From : Points[k].To;
+        break;
+      }
+    }
+  };
+
+  // A new corner starts on the straight rope it bent; a removed one ends on
+  // the straight rope it released. Neither pops.
+  for (int32 i = 0; i < Points.Num(); ++i) {
+    const FRemotePoint &Point = Points[i];
+    FVector Start = Point.From;
+    FVector End = Point.To;
+    FVector Prev, Next;
+    if (!Point.bInFrom) {
+      GetNeighbours(i, true, Prev, Next);
+      Start = FMath::ClosestPointOnSegment(End, Prev, Next);
+    } else if (!Point.bInTo) {
+      GetNeighbours(i, false, Prev, Next);
+      End = FMath::ClosestPointOnSegment(Start, Prev, Next);
+    }
+    RemotePoints.Add(FMath::Lerp(Start, End, Alpha));
+  }
+  RemotePoints.Add(PlayerPosition);
+}
+
+// ===================================================================
+// PENDULUM REPLICATION
+// ===================================================================
+
+void URopeSystemComponent::UpdateSwingReplicationMode() {
+  AActor *Owner = GetOwner();
+  const bool bPendulum = bReplicateSwingAsPendulum &&
+                         RopeState == ERopeState::Attached &&
+                         Owner->IsA<ACharacter>();
+  if (Owner->IsReplicatingMovement() != bPendulum)
+    return;
+
+  if (bPendulum) {
+    CapturePendulumState();
+  }
+  Owner->SetReplicateMovement(!bPendulum);
+
+  // Proxies integrate the swing between updates: it needs far fewer of them.
+  // The graph owns rates, so the per-actor setting goes through it.
+  if (SwingNetUpdateFrequency > 0.f) {
+    if (ULinkMeReplicationGraph *Graph =
+            ULinkMeReplicationGraph::Get(GetWorld())) {
+      Graph->SetActorReplicationFrequency(
+          Owner, bPendulum ? SwingNetUpdateFrequency : 0.f);
+    }
+  }
+
+  // Proxies switch over from an up-to-date state either way
+  Owner->ForceNetUpdate();
+}
+
+void URopeSystemComponent::CapturePendulumState() {
+  const ACharacter *OwnerChar = Cast<ACharacter>(GetOwner());
+  if (!OwnerChar || BendPoints.Num() < 2)
+    return;
+
+  const int32 PivotIndex = BendPoints.Num() - 2;
+  const FVector Offset = OwnerChar->GetActorLocation() - BendPoints[PivotIndex];
+  const float Distance = Offset.Size();
+  if (Distance < KINDA_SMALL_NUMBER)
+    return;
+
+  // v = w x r + radial: w = (u x v) / |r|
+  const FVector Direction = Offset / Distance;
+  const FVector Velocity = OwnerChar->GetVelocity();
+  PendulumState.PivotId = BendPointAnchors.IsValidIndex(PivotIndex)
+                              ? BendPointAnchors[PivotIndex].Id
+                              : 0;
+  PendulumState.Direction = Direction;
+  PendulumState.Length = Distance;
+  PendulumState.LengthRate = Velocity | Direction;
+  PendulumState.AngularVelocity = (Direction ^ Velocity) / Distance;
+  PendulumState.Yaw = OwnerChar->GetActorRotation().Yaw;
+  MARK_PROPERTY_DIRTY_FROM_NAME(URopeSystemComponent, PendulumState, this);
+}
+
+FVector URopeSystemComponent::GetRemoteSwingPivot() const {
+  // By Id: the topology and the swing may not arrive in the same update
+  if (PendulumState.PivotId != 0) {
+    for (const FRopeBendPointAnchor &Anchor : BendPointAnchors) {
+      if (Anchor.Id == PendulumState.PivotId)
+        return Anchor.Resolve();
+    }
+  }
+  return GetLastFixedPoint();
+}
+
+void URopeSystemComponent::OnRep_PendulumState() {
+  ACharacter *OwnerChar = Cast<ACharacter>(GetOwner());
+  if (!OwnerChar || OwnerChar->GetLocalRole() != ROLE_SimulatedProxy ||
+      RopeState != ERopeState::Attached || !PendulumState.IsValid())
+    return;
+
+  // The pawn stays where it is drawn; the gap to the server fades out.
+  // Further than this is a teleport, not an error.
+  constexpr float MaxRemoteSwingCorrection = 200.f;
+  const FVector Target = GetRemoteSwingPivot() + PendulumState.GetOffset();
+  RemoteSwingCorrection = OwnerChar->GetActorLocation() - Target;
+  if (RemoteSwingCorrection.SizeSquared() >
+      FMath::Square(MaxRemoteSwingCorrection)) {
+    RemoteSwingCorrection = FVector::ZeroVector;
+  }
+
+  RemoteSwingOffset = PendulumState.GetOffset();
+  RemoteSwingVelocity = PendulumState.GetVelocity();
+  RemoteSwingLength = PendulumState.Length;
+
+  if (!bSimulatingRemoteSwing) {
+    bSimulatingRemoteSwing = true;
+    // No generic movement arrives while swinging: the CMC would only
+    // extrapolate a stale velocity on top of ours
+    if (UCharacterMovementComponent *MoveComp =
+            OwnerChar->GetCharacterMovement()) {
+      MoveComp->SetComponentTickEnabled(false);
+    }
+  }
+}
+
+void URopeSystemComponent::UpdateRemoteSwing(float DeltaTime) {
+  if (!bSimulatingRemoteSwing)
+    return;
+
+  ACharacter *OwnerChar = Cast<ACharacter>(GetOwner());
+  UCharacterMovementComponent *MoveComp =
+      OwnerChar ? OwnerChar->GetCharacterMovement() : nullptr;
+  if (!MoveComp || RopeState != ERopeState::Attached) {
+    StopRemoteSwing();
+    return;
+  }
+
+  // Gravity, then back onto the sphere; the length follows its own rate
+  const float LengthRate = PendulumState.LengthRate;
+  RemoteSwingLength =
+      FMath::Max(0.f, RemoteSwingLength + LengthRate * DeltaTime);
+  RemoteSwingVelocity.Z += MoveComp->GetGravityZ() * DeltaTime;
+  RemoteSwingOffset += RemoteSwingVelocity * DeltaTime;
+
+  const FVector Direction =
+      RemoteSwingOffset.GetSafeNormal(UE_SMALL_NUMBER, -FVector::UpVector);
+  RemoteSwingOffset = Direction * RemoteSwingLength;
+  RemoteSwingVelocity +=
+      Direction * (LengthRate - (RemoteSwingVelocity | Direction));
+
+  RemoteSwingCorrection *= FMath::Exp(-RemoteSwingCorrectionRate * DeltaTime);
+
+  const FRotator Rotation = FMath::RInterpTo(
+      OwnerChar->GetActorRotation(), FRotator(0.f, PendulumState.Yaw, 0.f),
+      DeltaTime, RemoteSwingCorrectionRate);
+  OwnerChar->SetActorLocationAndRotation(
+      GetRemoteSwingPivot() + RemoteSwingOffset + RemoteSwingCorrection,
+      Rotation);
+
+  // Animation reads the movement component's velocity
+  MoveComp->Velocity = RemoteSwingVelocity;
+}
+
+void URopeSystemComponent::StopRemoteSwing() {
+  bSimulatingRemoteSwing = false;
+  RemoteSwingCorrection = FVector::ZeroVector;
+
+  if (const ACharacter *OwnerChar = Cast<ACharacter>(GetOwner())) {
+    if (UCharacterMovementComponent *MoveComp =
+            OwnerChar->GetCharacterMovement()) {
+      MoveComp->SetComponentTickEnabled(true);
+    }
+  }
+}
+
+// ===================================================================
+// BENDPOINT STORAGE & SIMPLIFICATION
+// ===================================================================
+
+void URopeSystemComponent::InsertBendPointInternal(
+    int32 Index, const FVector &Location, const FVector &Normal,
+    UPrimitiveComponent *Component) {
+  // Ropes initialised through older paths may lack side data
+  while (BendPointNormals.Num() < BendPoints.Num()) {
+    BendPointNormals.Add(FVector::UpVector);
+  }
+  BendPointWindings.SetNum(BendPoints.Num());
+  BendPointPredictions.SetNum(BendPoints.Num());
+
+  BendPointAnchors.SetNum(BendPoints.Num());
+
+  FRopeBendPointAnchor Anchor(Location, Component);
+  if (GetOwner()->HasAuthority()) {
+    // Only needs to be unique within one rope; 0 stays "unconfirmed"
+    Anchor.Id = NextBendPointId;
+    NextBendPointId = NextBendPointId == MAX_uint16 ? 1 : NextBendPointId + 1;
+  }
+  NumMovingAnchors += Anchor.IsMoving() ? 1 : 0;
+
+  // Moving points use the resolved (quantized) position so the server
+  // simulates exactly what clients will resolve
+  BendPoints.Insert(Anchor.IsMoving() ? Anchor.Resolve() : Location, Index);
+  BendPointNormals.Insert(Normal, Index);
+  BendPointWindings.Insert(FRopeWinding(), Index);
+  BendPointAnchors.Insert(Anchor, Index);
+
+  FRopeBendPointPrediction Prediction;
+  if (IsPredictingWraps()) {
+    Prediction.PredictedTime = GetWorld()->GetTimeSeconds();
+  }
+  BendPointPredictions.Insert(Prediction, Index);
+
+  bReplicatedAnchorsDirty = true;
+  MarkGeometryDirty(Index);
+}
+
+void URopeSystemComponent::RemoveBendPointInternal(int32 Index) {
+  if (!BendPoints.IsValidIndex(Index))
+    return;
+
+  if (BendPointWindings.IsValidIndex(Index)) {
+    TotalWrappedLength = FMath::Max(
+        0.f, TotalWrappedLength - BendPointWindings[Index].WrappedLength);
+    BendPointWindings.RemoveAt(Index);
+  }
+  if (BendPointNormals.IsValidIndex(Index)) {
+    BendPointNormals.RemoveAt(Index);
+  }
+  if (BendPointPredictions.IsValidIndex(Index)) {
+    // Removing a corner the server has: hold it off until the server agrees
+    if (!BendPointPredictions[Index].IsPending() && IsPredictingWraps() &&
+        BendPointAnchors.IsValidIndex(Index)) {
+      FPredictedRemoval &Removal = PredictedRemovals.AddDefaulted_GetRef();
+      Removal.Anchor = BendPointAnchors[Index];
+      Removal.Position = BendPoints[Index];
+      Removal.Time = GetWorld()->GetTimeSeconds();
+    }
+    BendPointPredictions.RemoveAt(Index);
+  }
+  if (BendPointAnchors.IsValidIndex(Index)) {
+    NumMovingAnchors -= BendPointAnchors[Index].IsMoving() ? 1 : 0;
+    BendPointAnchors.RemoveAt(Index);
+  }
+  BendPoints.RemoveAt(Index);
+  bReplicatedAnchorsDirty = true;
+  MarkGeometryDirty(Index);
+}
+
+void URopeSystemComponent::ClearBendPoints() {
+  BendPoints.Reset();
+  BendPointNormals.Reset();
+  BendPointWindings.Reset();
+  BendPointAnchors.Reset();
+  BendPointPredictions.Reset();
+  PredictedRemovals.Reset();
+  bHasPredictionOffsets = false;
+  NumMovingAnchors = 0;
+  TotalWrappedLength = 0.f;
+  bReplicatedAnchorsDirty = true;
+  MarkGeometryDirty(0);
+}
+
+void URopeSystemComponent::ResolveBendPointPositions() {
+  const bool bAttached = RopeState == ERopeState::Attached;
+  const int32 NumFixed = bAttached ? BendPoints.Num() - 1 : BendPoints.Num();
+
+  if (NumMovingAnchors > 0 && BendPointAnchors.Num() == BendPoints.Num()) {
+    for (int32 i = 0; i < NumFixed; ++i) {
+      const FRopeBendPointAnchor &Anchor = BendPointAnchors[i];
+      if (!Anchor.IsMoving())
+        continue;
+
+      const FVector Resolved = Anchor.Resolve();
+      if (!BendPoints[i].Equals(Resolved, 0.1f)) {
+        BendPoints[i] = Resolved;
+        MarkGeometryDirty(i);
+      }
+    }
+  }
+
+  // The player end is never replicated - every machine uses its own pawn
+  if (bAttached) {
+    UpdatePlayerPosition();
+  }
+}
+
+void URopeSystemComponent::RebuildBendPointsFromAnchors() {
+  BendPoints.SetNum(BendPointAnchors.Num());
+  NumMovingAnchors = 0;
+  for (int32 i = 0; i < BendPointAnchors.Num(); ++i) {
+    BendPoints[i] = BendPointAnchors[i].Resolve();
+    NumMovingAnchors += BendPointAnchors[i].IsMoving() ? 1 : 0;
+  }
+  BendPointPredictions.Reset();
+  BendPointPredictions.SetNum(BendPointAnchors.Num());
+  PredictedRemovals.Reset();
+  bHasPredictionOffsets = false;
+  MarkGeometryDirty(0);
+
+  if (RopeState == ERopeState::Attached) {
+    UpdatePlayerPosition();
+  }
+}
+
+void URopeSystemComponent::FlushReplicatedAnchors() {
+  if (!bReplicatedAnchorsDirty || !GetOwner()->HasAuthority())
+    return;
+
+  ReplicatedBendPointAnchors = BendPointAnchors;
+  MARK_PROPERTY_DIRTY_FROM_NAME(URopeSystemComponent,
+                                ReplicatedBendPointAnchors, this);
+  bReplicatedAnchorsDirty = false;
+}
+
+// ===================================================================
+// WRAP PREDICTION (owning client)
+// ===================================================================
+
+bool URopeSystemComponent::IsPredictingWraps() const {
+  if (!bPredictWrapsOnOwningClient || RopeState != ERopeState::Attached)
+    return false;
+
+  const APawn *OwnerPawn = Cast<APawn>(GetOwner());
+  return OwnerPawn && !OwnerPawn->HasAuthority() &&
+         OwnerPawn->IsLocallyControlled();
+}
+
+double URopeSystemComponent::GetPredictionTimeout() const {
+  // The server's answer needs a full round trip to come back
+  double Timeout = PredictionGracePeriod;
+  if (const APawn *OwnerPawn = Cast<APawn>(GetOwner())) {
+    if (const APlayerState *PlayerState = OwnerPawn->GetPlayerState()) {
+      Timeout += PlayerState->GetPingInMilliseconds() * 0.001;
+    }
+  }
+  return Timeout;
+}
+
+bool URopeSystemComponent::IsSameCorner(
+    const FRopeBendPointAnchor &Local, const FVector &LocalPosition,
+    const FRopeBendPointAnchor &Server) const {
+  // Indices shift with every wrap; the corner itself does not
+  if (Local.Id != 0 && Server.Id != 0)
+    return Local.Id == Server.Id;
+  return Local.Component == Server.Component &&
+         FVector::DistSquared(LocalPosition, Server.Resolve()) <=
+             FMath::Square(WrapMatchTolerance);
+}
+
+void URopeSystemComponent::ReconcilePredictedBendPoints() {
+  const TArray<FRopeBendPointAnchor> &Server = ReplicatedBendPointAnchors;
+  if (Server.Num() < 2)
+    return;
+
+  const double Now = GetWorld()->GetTimeSeconds();
+  const double Timeout = GetPredictionTimeout();
+
+  // Removals are done once the server dropped the corner too, and rolled
+  // back once they time out
+  PredictedRemovals.RemoveAllSwap([&](const FPredictedRemoval &Removal) {
+    if (Now - Removal.Time > Timeout)
+      return true;
+    for (const FRopeBendPointAnchor &Anchor : Server) {
+      if (IsSameCorner(Removal.Anchor, Removal.Position, Anchor))
+        return false;
+    }
+    return true;
+  });
+
+  struct FMergedPoint {
+    FRopeBendPointAnchor Anchor;
+    FVector Position = FVector::ZeroVector;
+    FVector Normal = FVector::UpVector;
+    FRopeWinding Winding;
+    FRopeBendPointPrediction Prediction;
+  };
+  TRopeScratchArray<FMergedPoint> Merged;
+
+  auto MakeLocal = [this](int32 Index) {
+    FMergedPoint Point;
+    Point.Anchor = BendPointAnchors[Index];
+    Point.Position = BendPoints[Index];
+    if (BendPointNormals.IsValidIndex(Index))
+      Point.Normal = BendPointNormals[Index];
+    if (BendPointWindings.IsValidIndex(Index))
+      Point.Winding = BendPointWindings[Index];
+    if (BendPointPredictions.IsValidIndex(Index))
+      Point.Prediction = BendPointPredictions[Index];
+    return Point;
+  };
+
+  // Unmatched local corners: pending ones wait for the server, the rest
+  // were mispredicted (or dropped by the server) and go
+  auto KeepIfPending = [&](int32 Index) {
+    const FRopeBendPointPrediction &Prediction = BendPointPredictions[Index];
+    if (Prediction.IsPending() && Now - Prediction.PredictedTime <= Timeout) {
+      Merged.Add(MakeLocal(Index));
+    }
+  };
+
+  // Fixed points only: the player entry is last on both sides. Both lists
+  // run anchor -> player, so matches are searched forward only.
+  const int32 NumLocalFixed =
+      FMath::Min(BendPoints.Num(), BendPointAnchors.Num()) - 1;
+  BendPointPredictions.SetNum(BendPoints.Num());
+  int32 NextLocal = 0;
+
+  for (int32 ServerIndex = 0; ServerIndex < Server.Num() - 1; ++ServerIndex) {
+    const FRopeBendPointAnchor &ServerAnchor = Server[ServerIndex];
+
+    // Unwrapped here already, the server has not caught up
+    if (PredictedRemovals.ContainsByPredicate(
+            [&](const FPredictedRemoval &Removal) {
+              return IsSameCorner(Removal.Anchor, Removal.Position,
+                                  ServerAnchor);
+            })) {
+      continue;
+    }
+
+    int32 Match = INDEX_NONE;
+    for (int32 i = NextLocal; i < NumLocalFixed; ++i) {
+      if (IsSameCorner(BendPointAnchors[i], BendPoints[i], ServerAnchor)) {
+        Match = i;
+        break;
+      }
+    }
+
+    FMergedPoint Point;
+    if (Match != INDEX_NONE) {
+      for (int32 i = NextLocal; i < Match; ++i) {
+        KeepIfPending(i);
+      }
+      Point = MakeLocal(Match);
+      NextLocal = Match + 1;
+    }
+
+    // Server position wins; a confirmed prediction keeps its look and
+    // slides over instead of popping
+    const FVector ServerPosition = ServerAnchor.Resolve();
+    Point.Prediction.VisualOffset =
+        (Match != INDEX_NONE)
+            ? Point.Position + Point.Prediction.VisualOffset - ServerPosition
+            : FVector::ZeroVector;
+    Point.Prediction.PredictedTime = 0.0;
+    Point.Anchor = ServerAnchor;
+    Point.Position = ServerPosition;
+    Merged.Add(Point);
+  }
+  for (int32 i = NextLocal; i < NumLocalFixed; ++i) {
+    KeepIfPending(i);
+  }
+
+  // Player end: every machine uses its own pawn
+  FMergedPoint Player;
+  Player.Anchor = Server.Last();
+  Player.Position = GetOwner()->GetActorLocation();
+  Merged.Add(Player);
+
+  BendPoints.Reset();
+  BendPointNormals.Reset();
+  BendPointWindings.Reset();
+  BendPointAnchors.Reset();
+  BendPointPredictions.Reset();
+  NumMovingAnchors = 0;
+  TotalWrappedLength = 0.f;
+  bHasPredictionOffsets = false;
+
+  for (const FMergedPoint &Point : Merged) {
+    BendPoints.Add(Point.Position);
+    BendPointNormals.Add(Point.Normal);
+    BendPointWindings.Add(Point.Winding);
+    BendPointAnchors.Add(Point.Anchor);
+    BendPointPredictions.Add(Point.Prediction);
+    NumMovingAnchors += Point.Anchor.IsMoving() ? 1 : 0;
+    TotalWrappedLength += Point.Winding.WrappedLength;
+    bHasPredictionOffsets |= !Point.Prediction.VisualOffset.IsZero();
+  }
+  MarkGeometryDirty(0);
+}
+
+void URopeSystemComponent::UpdateWrapPrediction(float DeltaTime) {
+  const double Now = GetWorld()->GetTimeSeconds();
+  const double Timeout = GetPredictionTimeout();
+
+  bool bExpired = PredictedRemovals.ContainsByPredicate(
+      [&](const FPredictedRemoval &Removal) {
+        return Now - Removal.Time > Timeout;
+      });
+  for (const FRopeBendPointPrediction &Prediction : BendPointPredictions) {
+    bExpired |=
+        Prediction.IsPending() && Now - Prediction.PredictedTime > Timeout;
+  }
+  if (bExpired) {
+    ReconcilePredictedBendPoints();
+  }
+
+  if (!bHasPredictionOffsets)
+    return;
+
+  const float Keep = FMath::Exp(-PredictionOffsetDecayRate * DeltaTime);
+  bHasPredictionOffsets = false;
+  for (FRopeBendPointPrediction &Prediction : BendPointPredictions) {
+    Prediction.VisualOffset *= Keep;
+    if (Prediction.VisualOffset.SizeSquared() < FMath::Square(0.1f)) {
+      Prediction.VisualOffset = FVector::ZeroVector;
+    }
+    bHasPredictionOffsets |= !Prediction.VisualOffset.IsZero();
+  }
+}
+
+int32 URopeSystemComponent::GetIntermediateBendPointCount() const {
+  // Attached: [Anchor, ..., Player] - Flying: only the wraps are stored
+  return RopeState == ERopeState::Attached
+             ? FMath::Max(0, BendPoints.Num() - 2)
+             : BendPoints.Num();
+}
+
+void URopeSystemComponent::SimplifyAfterInsert(int32 NewIndex) {
+  // 1. The new corner closes a loop around an earlier one
+  if (CollapseWinding(NewIndex))
+    return;
+
+  // 2. The previous corner now has two fixed neighbours and may be flat.
+  // The new corner itself is left alone: its outgoing segment goes to the
+  // moving player, so its angle is not final yet.
+  const int32 PrevIndex = NewIndex - 1;
+  if (PrevIndex > 0 && IsCollinearBendPoint(PrevIndex)) {
+    RemoveBendPointInternal(PrevIndex);
+    --NewIndex;
+    if (bShowDebug) {
+      UE_LOG(LogTemp, Log, TEXT("SIMPLIFY: Merged collinear bendpoint %d"),
+             PrevIndex);
+    }
+  }
+
+  // 3. Hard budget - keep the anchor and the new corner. If every older
+  // corner is a real wrap, the new one is refused instead.
+  if (!EnforceBendPointBudget(1, NewIndex - 1)) {
+    RemoveBendPointInternal(NewIndex);
+    if (bShowDebug) {
+      UE_LOG(LogTemp, Log, TEXT("SIMPLIFY: Budget full, wrap %d refused"),
+             NewIndex);
+    }
+  }
+}
+
+bool URopeSystemComponent::CollapseWinding(int32 NewIndex) {
+  if (RopeState != ERopeState::Attached ||
+      !BendPoints.IsValidIndex(NewIndex) || WindingMergeDistance <= 0.f)
+    return false;
+
+  const FVector NewPoint = BendPoints[NewIndex];
+  const float MergeDistSq = FMath::Square(WindingMergeDistance);
+
+  // A loop needs at least one other corner between the two visits
+  for (int32 LoopStart = NewIndex - 2; LoopStart >= 0; --LoopStart) {
+    if (FVector::DistSquared(BendPoints[LoopStart], NewPoint) > MergeDistSq)
+      continue;
+
+    // Length of LoopStart -> ... -> NewIndex, plus anything already wound on
+    // the corners being folded away
+    float LoopLength = 0.f;
+    int32 NestedLoops = 0;
+    for (int32 i = LoopStart; i < NewIndex; ++i) {
+      LoopLength += FVector::Dist(BendPoints[i], BendPoints[i + 1]);
+      LoopLength += BendPointWindings[i + 1].WrappedLength;
+      NestedLoops += BendPointWindings[i + 1].Count;
+    }
+
+    for (int32 i = NewIndex; i > LoopStart; --i) {
+      RemoveBendPointInternal(i);
+    }
+
+    FRopeWinding &Winding = BendPointWindings[LoopStart];
+    Winding.Count += 1 + NestedLoops;
+    Winding.WrappedLength += LoopLength;
+    TotalWrappedLength += LoopLength;
+
+    if (bShowDebug) {
+      UE_LOG(LogTemp, Log,
+             TEXT("SIMPLIFY: Winding collapsed on bendpoint %d (x%d, %.1f cm)"),
+             LoopStart, Winding.Count, Winding.WrappedLength);
+    }
+    return true;
+  }
+  return false;
+}
+
+bool URopeSystemComponent::EnforceBendPointBudget(int32 FirstRemovable,
+                                                  int32 LastRemovable) {
+  while (GetIntermediateBendPointCount() > MaxBendPoints) {
+    const int32 Victim = FindRedundantBendPoint(FirstRemovable, LastRemovable);
+    if (Victim == INDEX_NONE)
+      return false;
+
+    RemoveBendPointInternal(Victim);
+    --LastRemovable;
+
+    if (bShowDebug) {
+      UE_LOG(LogTemp, Log, TEXT("SIMPLIFY: Budget exceeded, merged %d"),
+             Victim);
+    }
+  }
+  return true;
+}
+
+bool URopeSystemComponent::IsCollinearBendPoint(int32 Index) const {
+  if (Index <= 0 || Index >= BendPoints.Num() - 1)
+    return false;
+  if (BendPointWindings.IsValidIndex(Index) &&
+      BendPointWindings[Index].Count > 0)
+    return false;
+
+  const FVector In =
+      (BendPoints[Index] - BendPoints[Index - 1]).GetSafeNormal();
+  const FVector Out =
+      (BendPoints[Index + 1] - BendPoints[Index]).GetSafeNormal();
+  return FVector::DotProduct(In, Out) >=
+         FMath::Cos(FMath::DegreesToRadians(CollinearMergeAngle));
+}
+
+int32 URopeSystemComponent::FindRedundantBendPoint(int32 First,
+                                                   int32 Last) const {
+  // Flat enough corners, straightest first
+  TRopeScratchArray<TPair<float, int32>> Candidates;
+  const float MinAlignment =
+      FMath::Cos(FMath::DegreesToRadians(BudgetMergeAngle));
+
+  First = FMath::Max(First, 1);
+  Last = FMath::Min(Last, BendPoints.Num() - 2);
+  for (int32 i = First; i <= Last; ++i) {
+    // Wound corners hold rope length, never drop them
+    if (BendPointWindings.IsValidIndex(i) && BendPointWindings[i].Count > 0)
+      continue;
+
+    const FVector In = (BendPoints[i] - BendPoints[i - 1]).GetSafeNormal();
+    const FVector Out = (BendPoints[i + 1] - BendPoints[i]).GetSafeNormal();
+    const float Alignment = FVector::DotProduct(In, Out);
+    if (Alignment >= MinAlignment) {
+      Candidates.Emplace(Alignment, i);
+    }
+  }
+  if (Candidates.IsEmpty())
+    return INDEX_NONE;
+
+  Candidates.Sort([](const TPair<float, int32> &A,
+                     const TPair<float, int32> &B) { return A.Key > B.Key; });
+
+  // A flat corner can still be a wrap (thin pole, edge seen edge-on): only
+  // merge it if its neighbours see each other
+  FCollisionQueryParams Params(SCENE_QUERY_STAT(RopeBudgetTrace), false,
+                               GetOwner());
+  if (CurrentHook)
+    Params.AddIgnoredActor(CurrentHook);
+
+  for (const TPair<float, int32> &Candidate : Candidates) {
+    const int32 i = Candidate.Value;
+    if (!GetWorld() ||
+        !GetWorld()->LineTraceTestByChannel(BendPoints[i - 1],
+                                            BendPoints[i + 1],
+                                            RopeTraceChannel, Params)) {
+      return i;
+    }
+  }
+  return INDEX_NONE;
+}
+
+// ===================================================================
+// GEOMETRY CACHE
+// ===================================================================
+
+void URopeSystemComponent::MarkGeometryDirty(int32 FirstDirtyIndex) {
+  GeometryDirtyIndex = (GeometryDirtyIndex == INDEX_NONE)
+                           ? FirstDirtyIndex
+                           : FMath::Min(GeometryDirtyIndex, FirstDirtyIndex);
+}
+
+void URopeSystemComponent::RefreshGeometryCache() {
+  // Attached: [Anchor, ..., LastFixed, Player] - the player is the free end.
+  // Flying bends are ordered player -> hook and are not cached.
+  const int32 ExpectedFixed = (RopeState == ERopeState::Attached)
+                                  ? FMath::Max(0, BendPoints.Num() - 1)
+                                  : 0;
+
+  if (GeometryDirtyIndex != INDEX_NONE ||
+      GeometryCache.NumFixed() != ExpectedFixed) {
+    const int32 FirstDirty =
+        (GeometryDirtyIndex != INDEX_NONE)
+            ? GeometryDirtyIndex
+            : FMath::Min(GeometryCache.NumFixed(), ExpectedFixed);
+    GeometryCache.RefreshFrom(BendPoints, ExpectedFixed, FirstDirty);
+    GeometryDirtyIndex = INDEX_NONE;
+  }
+  GeometryCache.SetWrappedLength(TotalWrappedLength);
+}
+
+const FRopeGeometryCache &URopeSystemComponent::GetGeometryCache() {
+  RefreshGeometryCache();
+  return GeometryCache;
+}
+
+float URopeSystemComponent::GetPhysicalLength() {
+  if (RopeState != ERopeState::Attached || BendPoints.Num() < 2)
+    return 0.f;
+  RefreshGeometryCache();
+  return GeometryCache.GetTotalLength(BendPoints.Last());
+}
+
 FVector URopeSystemComponent::GetLastFixedPoint() const {
   if (BendPoints.Num() < 2)
     return FVector::ZeroVector;
@@ -783,6 +1950,12 @@ bool URopeSystemComponent::CapsuleSweepBetween(const FVector &Start,
   bool bHit = GetWorld()->SweepSingleByChannel(
       OutHit, Start, End, FQuat::Identity, RopeTraceChannel, Capsule, Params);
 
+  // Remembered so the bend point BP adds next can ride on this component
+  if (bHit && OutHit.bBlockingHit) {
+    LastSweepComponent = OutHit.GetComponent();
+    LastSweepImpactPoint = OutHit.ImpactPoint;
+  }
+
   if (bShowDebug && bHit) {
     DrawDebugCapsule(GetWorld(), OutHit.ImpactPoint, Radius * 2.f, Radius,
                      FQuat::Identity, FColor::Orange, false, 1.f);
@@ -849,11 +2022,9 @@ void URopeSystemComponent::ApplyForcesToPlayer() {
     return;
   }
 
-  // Calculate total physical length
-  float TotalPhysicalLength = 0.f;
-  for (int32 i = 0; i < BendPoints.Num() - 1; ++i) {
-    TotalPhysicalLength += FVector::Distance(BendPoints[i], BendPoints[i + 1]);
-  }
+  // Total physical length (fixed spans are cached, only the free span and
+  // wound rope are added here)
+  const float TotalPhysicalLength = GetPhysicalLength();
 
   // Force direction towards last fixed point
   const FVector PlayerPos = BendPoints.Last();
@@ -1100,40 +2271,34 @@ void URopeSystemComponent::TransitionToAttached(const FHitResult &Hit) {
   // Final BendPoint setup (Preserve Flying Wraps!)
   // ==========================================================
 
-  // 1. Capture Flying Bends (Order: Near Player -> Near Hook)
-  TArray<FVector> FlyingBends = BendPoints;
-  TArray<FVector> FlyingNormals = BendPointNormals;
+  // 1. Capture Flying Bends (Order: Near Player -> Near Hook), on the stack
+  TRopeScratchArray<FVector> FlyingBends(BendPoints);
+  TRopeScratchArray<FVector> FlyingNormals(BendPointNormals);
+  TRopeScratchArray<FRopeBendPointAnchor> FlyingAnchors(BendPointAnchors);
 
   // 2. Reset
-  BendPoints.Reset();
-  BendPointNormals.Reset();
+  ClearBendPoints();
 
   // 3. Add Anchor (Start)
-  BendPoints.Add(CorrectedAnchor);
-  BendPointNormals.Add(Hit.ImpactNormal); // Anchor normal
+  InsertBendPointInternal(0, CorrectedAnchor, Hit.ImpactNormal,
+                          Hit.GetComponent());
 
   // 4. Append Flying Bends REVERSED (to match Order: Anchor -> Player)
   for (int32 i = FlyingBends.Num() - 1; i >= 0; --i) {
-    BendPoints.Add(FlyingBends[i]);
-    if (FlyingNormals.IsValidIndex(i)) {
-      BendPointNormals.Add(FlyingNormals[i]);
-    } else {
-      BendPointNormals.Add(FVector::UpVector);
-    }
+    InsertBendPointInternal(
+        BendPoints.Num(), FlyingBends[i],
+        FlyingNormals.IsValidIndex(i) ? FlyingNormals[i] : FVector::UpVector,
+        FlyingAnchors.IsValidIndex(i) ? FlyingAnchors[i].Component.Get()
+                                      : nullptr);
   }
 
-  // 5. Add Player (End)
-  BendPoints.Add(PlayerPosition);
-  BendPointNormals.Add(FVector::UpVector); // Player normal (dummy)
+  // 5. Add Player (End) - dummy normal
+  InsertBendPointInternal(BendPoints.Num(), PlayerPosition, FVector::UpVector);
 
-  // Calculate total length across all bends
-  float TotalDist = 0.f;
-  for (int32 i = 0; i < BendPoints.Num() - 1; ++i) {
-    TotalDist += FVector::Dist(BendPoints[i], BendPoints[i + 1]);
-  }
-  CurrentLength = FMath::Min(MaxLength, TotalDist);
+  SetRopeState(ERopeState::Attached);
 
-  RopeState = ERopeState::Attached;
+  // Total length across all bends
+  SetCurrentLength(FMath::Min(MaxLength, GetPhysicalLength()));
 
   // Notify camera: enter swinging state + hook attach effect
   if (ACharacter *OwnerChar = Cast<ACharacter>(GetOwner())) {
@@ -1288,15 +2453,25 @@ bool URopeSystemComponent::ShouldUnwrapPhysical(
 }
 
 void URopeSystemComponent::UpdateRopeVisual() {
+  // Dedicated server: nobody sees the rope, gameplay only needs BendPoints
+  if (!bRunCosmetics)
+    return;
+
+  SCOPE_CYCLE_COUNTER(STAT_RopeVisualUpdate);
+
   if (!RenderComponent) {
     RenderComponent =
         GetOwner() ? GetOwner()->FindComponentByClass<URopeRenderComponent>()
                    : nullptr;
     if (!RenderComponent)
       return;
+    BindRenderComponent();
   }
 
-  TArray<FVector> PointsToRender;
+  // Frame scratch on the mem stack, released when this returns
+  FMemMark Mark(FMemStack::Get());
+  FRopeFramePointArray PointsToRender;
+  PointsToRender.Reserve(FMath::Max(BendPoints.Num(), RemotePoints.Num()) + 2);
   bool bShouldRender = false;
   bool bIsDeploying = false;
 
@@ -1305,7 +2480,7 @@ void URopeSystemComponent::UpdateRopeVisual() {
     if (CurrentHook && GetOwner()) {
       // Flying Wraps Support
       // Order: Player -> [Intermediate Bends] -> Hook
-      PointsToRender.Add(GetOwner()->GetActorLocation());
+      PointsToRender.Add(GetPlayerEndLocation());
 
       // Add any wrapped points
       if (BendPoints.Num() > 0) {
@@ -1318,14 +2493,33 @@ void URopeSystemComponent::UpdateRopeVisual() {
       bIsDeploying = true; // Enable Dynamic RestLength
     }
   } else if (RopeState == ERopeState::Attached) {
-    if (BendPoints.Num() >= 2) {
+    if (bUseRemotePoints && RemotePoints.Num() >= 2) {
+      // Another player's rope, interpolated between network updates
+      PointsToRender.Append(RemotePoints);
+      bShouldRender = true;
+      bIsDeploying = false;
+    } else if (BendPoints.Num() >= 2) {
       // BendPoints already contains [Anchor, ... , Player]
-      PointsToRender = BendPoints;
+      PointsToRender.Append(BendPoints);
+
+      // Reconciled corners slide from the predicted spot to the server's
+      if (bHasPredictionOffsets &&
+          BendPointPredictions.Num() == PointsToRender.Num()) {
+        for (int32 i = 0; i < PointsToRender.Num(); ++i) {
+          PointsToRender[i] += BendPointPredictions[i].VisualOffset;
+        }
+      }
       bShouldRender = true;
       bIsDeploying = false;
     }
   }
 
+  // Pin the player end where the late update will (the hand socket), so
+  // the late update only removes this frame's movement
+  if (bShouldRender && RopeState == ERopeState::Attached) {
+    PointsToRender.Last() = GetPlayerEndLocation();
+  }
+
   // 2. Execute Update on Render Component
   if (bShouldRender) {
     bool bStateChanged = (RopeState != LastRopeState);
@@ -1337,14 +2531,14 @@ void URopeSystemComponent::UpdateRopeVisual() {
     // - State transition (Mode changed)
     // - Topology changed (Point count changed)
     if (bFirstRender || bStateChanged || bTopologyChanged) {
-      RenderComponent->UpdateRope(PointsToRender, bIsDeploying);
+      RenderComponent->UpdateRopePoints(PointsToRender, bIsDeploying);
     } else {
       // POSITION UPDATE ONLY
       // RenderComponent->UpdatePinPositions(PointsToRender); // Legacy opt
       // But we want to ensure Linkage, so UpdatePinPositions is OK if we fixed
       // it in Render. However, previous attempt used UpdateRope. The signature
       // is UpdateRope(Points, bDeploying).
-      RenderComponent->UpdateRope(PointsToRender, bIsDeploying);
+      RenderComponent->UpdateRopePoints(PointsToRender, bIsDeploying);
     }
 
     LastPointCount = PointsToRender.Num();
@@ -1367,4 +2561,68 @@ void URopeSystemComponent::UpdateRopeVisual() {
   }
 }
 
+FVector URopeSystemComponent::GetPlayerEndLocation() const {
+  if (HandSocketName != NAME_None) {
+    if (const ACharacter *OwnerChar = Cast<ACharacter>(GetOwner())) {
+      const USkeletalMeshComponent *Mesh = OwnerChar->GetMesh();
+      if (Mesh && Mesh->DoesSocketExist(HandSocketName)) {
+        return Mesh->GetSocketLocation(HandSocketName);
+      }
+    }
+  }
+  return GetOwner()->GetActorLocation();
+}
+
+void URopeSystemComponent::LateUpdatePlayerEnd() {
+  PlayerEndCorrection = 0.f;
+  if (!RenderComponent || !RenderComponent->IsRopeActive() ||
+      RopeState == ERopeState::Idle)
+    return;
+
+  SCOPE_CYCLE_COUNTER(STAT_RopeLateUpdate);
+
+  // The gameplay tick pinned the end to the hand as it was before movement
+  // and animation; the render simulates right after this, on the final pose.
+  // Flying ropes run player -> hook, attached ones anchor -> player.
+  const FVector PlayerEnd = GetPlayerEndLocation();
+  PlayerEndCorrection = RenderComponent->PinPlayerEnd(
+      PlayerEnd, RopeState == ERopeState::Flying);
+
+  const APawn *OwnerPawn = Cast<APawn>(GetOwner());
+  if (OwnerPawn && OwnerPawn->IsLocallyControlled()) {
+    SET_FLOAT_STAT(STAT_RopeEndCorrection, PlayerEndCorrection);
+  }
+}
+
+void URopeSystemComponent::BindRenderComponent() {
+  if (RenderComponent && bRunCosmetics) {
+    RenderComponent->OnStepped.BindUObject(
+        this, &URopeSystemComponent::MeasurePlayerEndOffset);
+  }
+}
+
+void URopeSystemComponent::MeasurePlayerEndOffset() {
+  // Local pawn only: the stat and the debug line are about what the player
+  // sees at the end of their own rope
+  const APawn *OwnerPawn = Cast<APawn>(GetOwner());
+  if (!OwnerPawn || !OwnerPawn->IsLocallyControlled() ||
+      RopeState == ERopeState::Idle) {
+    PlayerEndOffset = 0.f;
+    return;
+  }
+
+  // After the step: where the rope is drawn versus where the hand is
+  PlayerEndOffset = FVector::Dist(
+      RenderComponent->GetPlayerEndPosition(RopeState == ERopeState::Flying),
+      GetPlayerEndLocation());
+  SET_FLOAT_STAT(STAT_RopeEndOffset, PlayerEndOffset);
+
+  if (bShowDebug && GEngine) {
+    GEngine->AddOnScreenDebugMessage(
+        3, 0.f, FColor::Yellow,
+        FString::Printf(TEXT("Rope End Offset: %.1f cm (late update %.1f cm)"),
+                        PlayerEndOffset, PlayerEndCorrection));
+  }
+}
+
 // End of file
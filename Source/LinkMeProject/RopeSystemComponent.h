@@ -4,12 +4,22 @@
 
 #include "Components/ActorComponent.h"
 #include "CoreMinimal.h"
+#include "Misc/MemStack.h"
+#include "RopeGeometryCache.h"
 #include "RopeTypes.h"
 
 #include "RopeSystemComponent.generated.h"
 
 class ARopeHookActor;
 class URopeRenderComponent;
+class URopeSystemComponent;
+
+/** Scratch arrays of the rope tick: inline up to a typical bend count */
+template <typename T> using TRopeScratchArray = TArray<T, TInlineAllocator<32>>;
+
+/** Points handed to the renderer, on the frame's memory stack (needs an
+ * FMemMark in scope) */
+using FRopeFramePointArray = TArray<FVector, TMemStackAllocator<>>;
 
 UENUM(BlueprintType)
 enum class ERopeState : uint8 { Idle, Flying, Attached };
@@ -51,6 +61,26 @@ struct FSwingPhysicsSettings {
   float VelocityDamping = 0.1f;
 };
 
+/** Re-pins the rendered player end once the pose is final */
+USTRUCT()
+struct FRopeLateUpdateTickFunction : public FTickFunction {
+  GENERATED_BODY()
+
+  URopeSystemComponent *Target = nullptr;
+
+  virtual void
+  ExecuteTick(float DeltaTime, ELevelTick TickType,
+              ENamedThreads::Type CurrentThread,
+              const FGraphEventRef &MyCompletionGraphEvent) override;
+  virtual FString DiagnosticMessage() override;
+};
+
+template <>
+struct TStructOpsTypeTraits<FRopeLateUpdateTickFunction>
+    : public TStructOpsTypeTraitsBase2<FRopeLateUpdateTickFunction> {
+  enum { WithCopy = false };
+};
+
 /**
  * Lightweight rope brain: manages state, forces, and provides tools for
  * Blueprint logic. Wrap/Unwrap logic is intentionally left to Blueprint for
@@ -70,6 +100,33 @@ public:
                 FActorComponentTickFunction *ThisTickFunction) override;
   virtual void GetLifetimeReplicatedProps(
       TArray<FLifetimeProperty> &OutLifetimeProps) const override;
+  virtual void
+  PreReplication(IRepChangedPropertyTracker &ChangedPropertyTracker) override;
+  virtual void RegisterComponentTickFunctions(bool bRegister) override;
+
+  // ===================================================================
+  // LATE UPDATE - rendered player end
+  // ===================================================================
+
+  /**
+   * Post-physics tick: runs once movement and animation have produced the
+   * final pose of the frame, before the rope render simulates. The pipeline
+   * (UCharacterPipelineSubsystem) orders it after the mesh.
+   */
+  FRopeLateUpdateTickFunction LateUpdateTick;
+
+  /** Hand socket (HandSocketName) if the mesh has it, else the actor */
+  FVector GetPlayerEndLocation() const;
+
+  /** How far the late update moved the rendered player end this frame (cm):
+   * the lag the rope would have shown without it */
+  UFUNCTION(BlueprintPure, Category = "Rope|Debug")
+  float GetPlayerEndCorrection() const { return PlayerEndCorrection; }
+
+  /** Distance between the simulated player end and the hand after the
+   * render step (cm, local pawn): what is left of the lag on screen */
+  UFUNCTION(BlueprintPure, Category = "Rope|Debug")
+  float GetPlayerEndOffset() const { return PlayerEndOffset; }
 
   // ===================================================================
   // ACTIONS - Called from Blueprint Input Handlers
@@ -83,13 +140,13 @@ public:
   UFUNCTION(BlueprintCallable, Category = "Rope|Actions")
   void FireChargedHook(const FVector &Velocity);
 
-  /** Server RPC for FireHook */
+  /** Server RPC for FireHook. ClientFireTime: see GetClientViewTime. */
   UFUNCTION(Server, Reliable)
-  void ServerFireHook(const FVector &Direction);
+  void ServerFireHook(const FVector &Direction, double ClientFireTime);
 
   /** Server RPC for FireChargedHook */
   UFUNCTION(Server, Reliable)
-  void ServerFireChargedHook(const FVector &Velocity);
+  void ServerFireChargedHook(const FVector &Velocity, double ClientFireTime);
 
   /** Cut the rope and detach. */
   UFUNCTION(BlueprintCallable, Category = "Rope|Actions")
@@ -100,6 +157,18 @@ public:
   UFUNCTION(BlueprintCallable, Category = "Rope|Actions")
   void SwingJump(float BoostMultiplier = 1.2f);
 
+  /** SwingJump graded at an explicit input timestamp (world seconds), for
+   * callers that know when the button was actually pressed. */
+  UFUNCTION(BlueprintCallable, Category = "Rope|Actions")
+  void SwingJumpAtTime(float BoostMultiplier, double InputTimeSeconds);
+
+  /** When a press handled this frame happened (world seconds): the
+   * platform's stamp where there is one (UInputTimestampSubsystem),
+   * otherwise the midpoint of the last frame interval (error within half a
+   * frame). Call from input handlers. */
+  UFUNCTION(BlueprintPure, Category = "Rope|Actions")
+  double GetInputTimeSeconds() const;
+
   /** Called when SwingJump is executed. Implement in BP for VFX/Audio. */
   UFUNCTION(BlueprintImplementableEvent, Category = "Rope|Events")
   void OnSwingJump();
@@ -137,16 +206,37 @@ public:
   /**
    * Add a new bendpoint with surface normal capture (RECOMMENDED for Surface
    * Normal Validation). This overload should be used when adding bend points
-   * from wrap detection logic.
+   * from wrap detection logic. The point rides on the last
+   * CapsuleSweepBetween hit if it lies within SweepComponentMatchDistance of
+   * it; AddBendPointOnComponent with the hit's component is the explicit
+   * form.
    */
   UFUNCTION(BlueprintCallable, Category = "Rope|BendPoints")
   void AddBendPointWithNormal(const FVector &Location,
                               const FVector &SurfaceNormal);
 
+  /**
+   * Add a bendpoint that rides on a component (moving platforms). The point is
+   * stored relative to Component and re-resolved every tick. Static or null
+   * components behave like AddBendPointWithNormal.
+   */
+  UFUNCTION(BlueprintCallable, Category = "Rope|BendPoints")
+  void AddBendPointOnComponent(const FVector &Location,
+                               const FVector &SurfaceNormal,
+                               UPrimitiveComponent *Component);
+
   /** Remove the bendpoint at the given index. */
   UFUNCTION(BlueprintCallable, Category = "Rope|BendPoints")
   void RemoveBendPointAt(int32 Index);
 
+  /** Rope length consumed by collapsed windings (not part of BendPoints). */
+  UFUNCTION(BlueprintPure, Category = "Rope|BendPoints")
+  float GetWrappedLength() const { return TotalWrappedLength; }
+
+  /** Total number of windings collapsed into bend points. */
+  UFUNCTION(BlueprintPure, Category = "Rope|BendPoints")
+  int32 GetWindingCount() const;
+
   /** Get the last fixed bendpoint (the one before the player). */
   UFUNCTION(BlueprintPure, Category = "Rope|BendPoints")
   FVector GetLastFixedPoint() const;
@@ -274,6 +364,14 @@ public:
   UFUNCTION(BlueprintPure, Category = "Rope|State")
   float GetMaxLength() const { return MaxLength; }
 
+  /** Physical rope length: fixed spans + free span + wound rope. O(1). */
+  UFUNCTION(BlueprintPure, Category = "Rope|State")
+  float GetPhysicalLength();
+
+  /** Prefix-summed fixed spans [Anchor .. LastFixed] (Attached only).
+   * Refreshed lazily from the last mutated index. */
+  const FRopeGeometryCache &GetGeometryCache();
+
   UFUNCTION(BlueprintPure, Category = "Rope|State")
   ERopeState GetRopeState() const { return RopeState; }
 
@@ -323,7 +421,8 @@ public:
   TSubclassOf<ARopeHookActor> HookClass;
 
   /** Socket name on the Character Mesh to spawn the hook from (e.g. 'hand_r').
-   * If empty or not found, uses default offset. */
+   * If empty or not found, uses default offset. The rendered rope's player
+   * end is pinned to it too. */
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rope|Config")
   FName HandSocketName = NAME_None;
 
@@ -361,6 +460,40 @@ public:
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rope|Performance")
   bool bUseSubsteppedPhysics = true;
 
+  /** Max intermediate bend points (anchor and player excluded). Beyond this,
+   * a redundant corner is merged away (see BudgetMergeAngle) or, if there is
+   * none, the new bend point is refused, so tick and replication cost stay
+   * flat. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rope|Performance",
+            meta = (ClampMin = "1", ClampMax = "64"))
+  int32 MaxBendPoints = 16;
+
+  /** Corners deviating less than this (degrees) are merged into the straight
+   * line between their neighbours. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rope|Performance",
+            meta = (ClampMin = "0", ClampMax = "45"))
+  float CollinearMergeAngle = 2.f;
+
+  /** Over MaxBendPoints, corners deviating less than this (degrees) may be
+   * merged if the rope between their neighbours is clear of geometry. Real
+   * wraps are never dropped. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rope|Performance",
+            meta = (ClampMin = "0", ClampMax = "45"))
+  float BudgetMergeAngle = 10.f;
+
+  /** A new bend point this close to an earlier corner closes a full loop
+   * around it; the loop is collapsed into a winding on that corner. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rope|Performance",
+            meta = (ClampMin = "0"))
+  float WindingMergeDistance = 20.f;
+
+  /** AddBendPointWithNormal: a point this close to the last
+   * CapsuleSweepBetween impact rides on the component that sweep hit
+   * (cm, 0 = never) */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rope|BendPoints",
+            meta = (ClampMin = "0"))
+  float SweepComponentMatchDistance = 50.f;
+
   UPROPERTY()
   class URopeCameraManager *CachedCameraManager;
 
@@ -368,6 +501,67 @@ public:
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rope|Debug")
   bool bShowDebug = false;
 
+  // ===================================================================
+  // WRAP PREDICTION (owning client)
+  // ===================================================================
+
+  /** Run OnRopeTickAttached on the owning client too, so its wraps show
+   * immediately instead of a round trip later. The BP can branch on
+   * IsPredictingWraps() to skip server-only work. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rope|Prediction")
+  bool bPredictWrapsOnOwningClient = true;
+
+  /** A prediction the server has not confirmed after this long (plus the
+   * ping) is rolled back (s) */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rope|Prediction",
+            meta = (ClampMin = "0"))
+  float PredictionGracePeriod = 0.2f;
+
+  /** Predicted and server bend points closer than this, on the same
+   * component, are the same corner (cm) */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rope|Prediction",
+            meta = (ClampMin = "0"))
+  float WrapMatchTolerance = 30.f;
+
+  /** How fast the visual gap between a predicted corner and the server's
+   * closes (1/s) */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rope|Prediction",
+            meta = (ClampMin = "0"))
+  float PredictionOffsetDecayRate = 12.f;
+
+  /** True on the owning client when it runs the wrap logic locally */
+  UFUNCTION(BlueprintPure, Category = "Rope|Prediction")
+  bool IsPredictingWraps() const;
+
+  // ===================================================================
+  // REMOTE ROPE SMOOTHING (simulated proxies)
+  // ===================================================================
+
+  /** Other players' ropes are drawn this far in the past, between two
+   * received topologies. Should cover about two update intervals (s);
+   * 0 draws each update as it arrives. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rope|Network",
+            meta = (ClampMin = "0"))
+  float RemoteInterpolationDelay = 0.12f;
+
+  /** While attached, replicate the swing as FRopePendulumState (skip
+   * owner) instead of the pawn's generic movement. Simulated proxies
+   * integrate the arc between updates instead of smoothing along chords. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rope|Network")
+  bool bReplicateSwingAsPendulum = true;
+
+  /** How fast a remote swing absorbs the error left by an update (1/s) */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rope|Network",
+            meta = (ClampMin = "0"))
+  float RemoteSwingCorrectionRate = 8.f;
+
+  /** Owner's replication rate while its swing replicates as a pendulum
+   * (Hz), set through the replication graph. The class rate comes back on
+   * detach; 0 leaves it alone. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rope|Network",
+            meta = (ClampMin = "0"))
+  float SwingNetUpdateFrequency = 20.f;
+
   // ===================================================================
   // APEX WINDOW CONFIGURATION
   // ===================================================================
@@ -408,6 +602,11 @@ public:
             meta = (ClampMin = "0", ClampMax = "1"))
   float SwingArcApexEnd = 0.6f;
 
+  /** Current or next apex window in world seconds (predicted from height,
+   * vertical speed and gravity). Returns false if no window is coming. */
+  UFUNCTION(BlueprintPure, Category = "Rope|Apex")
+  bool GetPredictedApexWindow(double &OutOpenTime, double &OutCloseTime) const;
+
   /** Multicast event fired on apex jump (use for UI/Audio) */
   UPROPERTY(BlueprintAssignable, Category = "Rope|Events")
   FOnApexJump OnApexJump;
@@ -423,6 +622,18 @@ protected:
   void ApplyForcesToPlayer();
   void UpdateRopeVisual();
 
+  friend struct FRopeLateUpdateTickFunction;
+
+  /** Drives UpdateRopeVisual on a hand-set rope (Tests/) */
+  friend class FRopeTickAllocationTest;
+
+  /** Re-pin the rendered player end to this frame's final pose */
+  void LateUpdatePlayerEnd();
+
+  /** Hook MeasurePlayerEndOffset to the render component's steps */
+  void BindRenderComponent();
+  void MeasurePlayerEndOffset();
+
   // Timer-based physics tick (called at PhysicsUpdateRate)
   void PhysicsTick();
 
@@ -434,12 +645,30 @@ protected:
 
   void TransitionToAttached(const FHitResult &Hit);
 
+  // Lag compensation (see URopeRewindSubsystem)
+  /** Server time of the world this machine is showing (remote actors lag
+   * the server by about half the ping) */
+  double GetClientViewTime() const;
+  /** Server: how far back to sweep for a shot fired at ClientFireTime */
+  float GetRewindLatency(double ClientFireTime) const;
+
   // Timer handle for physics updates
   FTimerHandle PhysicsTimerHandle;
 
-  // Apex window state
+  // Apex window state - timestamps are solved analytically, not accumulated
   bool bIsInApexWindow = false;
-  float ApexWindowTimer = 0.f;
+  bool bIsInApexBand = false;
+  double ApexWindowOpenTime = -1.0;
+  double ApexWindowCloseTime = -1.0;
+  /** Last window that actually opened, kept once the next one is predicted
+   * so a press stamped just before the close is still graded */
+  double LastApexWindowOpenTime = -1.0;
+  double LastApexWindowCloseTime = -1.0;
+  /** GFrameCounter of the last swing jump: a Blueprint handler and the
+   * native binding may both fire for the same press */
+  uint64 LastSwingJumpFrame = 0;
+
+  void ResetApexWindow();
 
   /** Update apex detection logic (called in Tick) */
   void UpdateApexDetection(float DeltaTime);
@@ -447,17 +676,144 @@ protected:
   /** Determine tier based on boost percentage (0-1) */
   EApexTier DetermineTierFromBoost(float BoostPercent) const;
 
+  // Bend point storage - every mutation goes through these so the parallel
+  // arrays (positions, normals, windings) never drift apart
+  void InsertBendPointInternal(int32 Index, const FVector &Location,
+                               const FVector &Normal,
+                               UPrimitiveComponent *Component = nullptr);
+  void RemoveBendPointInternal(int32 Index);
+  void ClearBendPoints();
+
+  // Budget & simplification (see MaxBendPoints)
+  int32 GetIntermediateBendPointCount() const;
+  void SimplifyAfterInsert(int32 NewIndex);
+  bool CollapseWinding(int32 NewIndex);
+  /** False if still over budget with no redundant corner left */
+  bool EnforceBendPointBudget(int32 FirstRemovable, int32 LastRemovable);
+  bool IsCollinearBendPoint(int32 Index) const;
+  int32 FindRedundantBendPoint(int32 First, int32 Last) const;
+
+  /** Re-resolve component-relative bend points and the player end (all
+   * machines, once per tick) */
+  void ResolveBendPointPositions();
+
+  /** Rebuild world BendPoints from the replicated anchors (clients) */
+  void RebuildBendPointsFromAnchors();
+
+  /** Server: copy BendPointAnchors to the replicated list if it changed */
+  void FlushReplicatedAnchors();
+
+  // Wrap prediction (owning client, see bPredictWrapsOnOwningClient)
+  /** Merge the local (predicted) list with the server's by corner identity:
+   * confirmed corners keep their look, pending ones survive their grace
+   * period, stale ones roll back */
+  void ReconcilePredictedBendPoints();
+  /** Expire stale predictions and fade reconciliation offsets */
+  void UpdateWrapPrediction(float DeltaTime);
+  bool IsSameCorner(const FRopeBendPointAnchor &Local,
+                    const FVector &LocalPosition,
+                    const FRopeBendPointAnchor &Server) const;
+  double GetPredictionTimeout() const;
+
+  // Remote rope smoothing (simulated proxies, see RemoteInterpolationDelay)
+  bool IsRemoteRope() const;
+  /** Buffer the topology just received, stamped with the local time. After
+   * a quiet period the previous one is re-stamped at the render time. */
+  void PushRemoteSnapshot();
+  /** Fill RemotePoints for the delayed render time. Points are matched by
+   * Id; new corners slide out of the straight rope, dropped ones fold back
+   * into it. */
+  void UpdateRemoteInterpolation();
+
+  // Replicated state goes through these (push model marks it dirty)
+  void SetRopeState(ERopeState NewState);
+  void SetCurrentLength(float NewLength);
+  void SetCurrentHook(ARopeHookActor *NewHook);
+
+  // Pendulum replication (see bReplicateSwingAsPendulum)
+  /** Server: generic movement replication off while attached */
+  void UpdateSwingReplicationMode();
+  /** Server: capture the swing around the last fixed point */
+  void CapturePendulumState();
+  /** Simulated proxy: integrate the replicated swing and place the pawn */
+  void UpdateRemoteSwing(float DeltaTime);
+  void StopRemoteSwing();
+  FVector GetRemoteSwingPivot() const;
+
+  // Geometry cache - mutations mark the first dirty index, readers flush
+  void MarkGeometryDirty(int32 FirstDirtyIndex);
+  void RefreshGeometryCache();
+
 protected:
   UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Replicated,
             Category = "Rope|State")
   float CurrentLength = 0.f;
 
-  /** Bend point positions - Replicated for network efficiency (12 bytes per
-   * point) */
-  UPROPERTY(VisibleAnywhere, BlueprintReadOnly,
-            ReplicatedUsing = OnRep_BendPoints, Category = "Rope|State")
+  /** World-space bend points, resolved once per tick from BendPointAnchors.
+   * Not replicated - clients rebuild them from the anchors. */
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Rope|State")
   TArray<FVector> BendPoints;
 
+  /** Compact form of BendPoints (parallel array): quantized local position
+   * + moving component. The player entry is never updated after creation,
+   * so swinging does not dirty it. */
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Rope|State")
+  TArray<FRopeBendPointAnchor> BendPointAnchors;
+
+  /** Server copy of BendPointAnchors, flushed once per tick. Kept apart so
+   * the owning client can predict into BendPointAnchors without corrupting
+   * delta-replicated state. */
+  UPROPERTY(ReplicatedUsing = OnRep_BendPoints)
+  TArray<FRopeBendPointAnchor> ReplicatedBendPointAnchors;
+
+  bool bReplicatedAnchorsDirty = false;
+
+  /** Owning client only (parallel to BendPoints) */
+  TArray<FRopeBendPointPrediction> BendPointPredictions;
+
+  /** Server corners the owning client removed ahead of the server */
+  struct FPredictedRemoval {
+    FRopeBendPointAnchor Anchor;
+    FVector Position = FVector::ZeroVector;
+    double Time = 0.0;
+  };
+  TArray<FPredictedRemoval> PredictedRemovals;
+
+  bool bHasPredictionOffsets = false;
+
+  /** Server: next FRopeBendPointAnchor::Id (0 is reserved) */
+  uint16 NextBendPointId = 1;
+
+  /** Simulated proxies: received topologies, oldest first */
+  struct FRemoteSnapshot {
+    double Time = 0.0;
+    TArray<FRopeBendPointAnchor> Anchors;
+  };
+  TArray<FRemoteSnapshot> RemoteSnapshots;
+
+  /** Interpolated fixed points + player end, drawn instead of BendPoints */
+  TArray<FVector> RemotePoints;
+  bool bUseRemotePoints = false;
+
+  /** Server swing, sent to everyone but the owner */
+  UPROPERTY(ReplicatedUsing = OnRep_PendulumState)
+  FRopePendulumState PendulumState;
+
+  /** Simulated proxies: locally integrated swing (pivot-relative) */
+  bool bSimulatingRemoteSwing = false;
+  FVector RemoteSwingOffset = FVector::ZeroVector;
+  FVector RemoteSwingVelocity = FVector::ZeroVector;
+  FVector RemoteSwingCorrection = FVector::ZeroVector;
+  float RemoteSwingLength = 0.f;
+
+  /** Number of anchors riding on a movable component (0 = skip resolve) */
+  int32 NumMovingAnchors = 0;
+
+  /** Last CapsuleSweepBetween hit, used to attach BP-added bend points to
+   * the component they were traced against */
+  TWeakObjectPtr<UPrimitiveComponent> LastSweepComponent;
+  FVector LastSweepImpactPoint = FVector::ZeroVector;
+
   /**
    * Surface normals for each bend point - NOT replicated for bandwidth
    * optimization. Only used server-side for Surface Normal Validation. Clients
@@ -466,9 +822,27 @@ protected:
   UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Rope|State")
   TArray<FVector> BendPointNormals;
 
+  /** Collapsed windings for each bend point (parallel to BendPoints). Server
+   * side only - the length they hold is folded into the physics length. */
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Rope|State")
+  TArray<FRopeWinding> BendPointWindings;
+
+  /** Sum of BendPointWindings[].WrappedLength, kept up to date on mutation */
+  float TotalWrappedLength = 0.f;
+
+  /** Fixed-span lengths shared by physics, apex detection and debug */
+  FRopeGeometryCache GeometryCache;
+
+  /** Lowest BendPoints index changed since the last flush (INDEX_NONE =
+   * clean) */
+  int32 GeometryDirtyIndex = 0;
+
   UFUNCTION()
   void OnRep_BendPoints();
 
+  UFUNCTION()
+  void OnRep_PendulumState();
+
   UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Replicated,
             Category = "Rope|State")
   ERopeState RopeState = ERopeState::Idle;
@@ -486,5 +860,14 @@ protected:
   UPROPERTY(Transient)
   int32 LastPointCount = 0;
 
+  /** Cached at BeginPlay; false on a dedicated server (no rope visuals) */
+  bool bRunCosmetics = true;
+
+  /** Last late update's correction, see GetPlayerEndCorrection */
+  float PlayerEndCorrection = 0.f;
+
+  /** Last render step's offset, see GetPlayerEndOffset */
+  float PlayerEndOffset = 0.f;
+
   float DefaultBrakingDeceleration = 0.f;
 };
@@ -0,0 +1,26 @@
+// RopeTypes.cpp
+
+#include "RopeTypes.h"
+#include "Components/PrimitiveComponent.h"
+
+FRopeBendPointAnchor::FRopeBendPointAnchor(const FVector &WorldPosition,
+                                           UPrimitiveComponent *InComponent) {
+  // A component that does not replicate as a reference would arrive null
+  // and the local position would be read as a world one: keep it in world
+  // space on every machine instead
+  if (InComponent && InComponent->Mobility == EComponentMobility::Movable &&
+      InComponent->IsSupportedForNetworking()) {
+    Component = InComponent;
+    LocalPosition =
+        InComponent->GetComponentTransform().InverseTransformPosition(
+            WorldPosition);
+  } else {
+    LocalPosition = WorldPosition;
+  }
+}
+
+FVector FRopeBendPointAnchor::Resolve() const {
+  const UPrimitiveComponent *Comp = Component.Get();
+  return Comp ? Comp->GetComponentTransform().TransformPosition(LocalPosition)
+              : FVector(LocalPosition);
+}
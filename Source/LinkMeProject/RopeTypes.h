@@ -2,8 +2,11 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Engine/NetSerialization.h"
 #include "RopeTypes.generated.h"
 
+class UPrimitiveComponent;
+
 /** Un point de changement de direction sur un obstacle (edge lock) */
 USTRUCT(BlueprintType)
 struct FRopeBendpoint {
@@ -44,6 +47,66 @@ struct FRopeBendpoint {
         bHasValidNormal(!InNormal.IsNearlyZero()) {}
 };
 
+/**
+ * Forme compacte (répliquée) d'un bend point : position relative au
+ * HitComponent quand celui-ci bouge, sinon position monde.
+ */
+USTRUCT(BlueprintType)
+struct FRopeBendPointAnchor {
+  GENERATED_BODY();
+
+  /** Local space of Component, or world space when Component is null */
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+  FVector_NetQuantize10 LocalPosition = FVector::ZeroVector;
+
+  /** Movable, net-addressable component the point rides on (static geometry
+   * and components clients cannot resolve are not stored) */
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+  TWeakObjectPtr<UPrimitiveComponent> Component;
+
+  /** Server-assigned, stable while the point exists (0 = not yet confirmed,
+   * e.g. a client prediction). Lets clients follow a point across updates
+   * whatever its index. */
+  UPROPERTY()
+  uint16 Id = 0;
+
+  FRopeBendPointAnchor() = default;
+
+  FRopeBendPointAnchor(const FVector &WorldPosition,
+                       UPrimitiveComponent *InComponent);
+
+  /** True if the point follows a component and must be resolved each tick */
+  bool IsMoving() const { return !Component.IsExplicitlyNull(); }
+
+  /** World position (the local one as is once the component is gone) */
+  FVector Resolve() const;
+};
+
+/** Enroulements répétés autour d'un même coin, fusionnés dans un bend point */
+USTRUCT(BlueprintType)
+struct FRopeWinding {
+  GENERATED_BODY();
+
+  /** Nombre de tours complets fusionnés dans ce bend point */
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+  int32 Count = 0;
+
+  /** Longueur de corde prise par ces tours (absente de la polyligne) */
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+  float WrappedLength = 0.f;
+};
+
+/** Owning-client prediction state of a bend point (parallel to BendPoints) */
+struct FRopeBendPointPrediction {
+  /** World time the point was predicted locally (0 = server confirmed) */
+  double PredictedTime = 0.0;
+
+  /** Render-only offset left by reconciliation, fades to zero */
+  FVector VisualOffset = FVector::ZeroVector;
+
+  bool IsPending() const { return PredictedTime > 0.0; }
+};
+
 /** Segment géométrique corde (pour debug / draw) */
 USTRUCT(BlueprintType)
 struct FRopeSegment {
@@ -77,3 +140,102 @@ struct FRopeTensionSettings {
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rope")
   float TangentialFriction = 0.1f;
 };
+
+/**
+ * Swing replicated to simulated proxies instead of the generic movement:
+ * while attached the pawn is a pendulum around the last fixed point, so
+ * direction, length and their rates are enough to rebuild the arc.
+ * NetSerialize packs it into 18 bytes.
+ */
+USTRUCT()
+struct FRopePendulumState {
+  GENERATED_BODY();
+
+  /** FRopeBendPointAnchor::Id of the pivot (last fixed point) */
+  UPROPERTY()
+  uint16 PivotId = 0;
+
+  /** Pivot -> pawn, unit length (sent as two angles) */
+  UPROPERTY()
+  FVector Direction = -FVector::UpVector;
+
+  /** Pivot -> pawn distance (cm) and its rate (cm/s) */
+  UPROPERTY()
+  float Length = 0.f;
+
+  UPROPERTY()
+  float LengthRate = 0.f;
+
+  /** Swing rate around the pivot (rad/s), perpendicular to Direction */
+  UPROPERTY()
+  FVector AngularVelocity = FVector::ZeroVector;
+
+  /** Pawn facing (the actor rotation is not replicated while swinging) */
+  UPROPERTY()
+  float Yaw = 0.f;
+
+  bool IsValid() const { return Length > 0.f; }
+
+  FVector GetOffset() const { return Direction * Length; }
+
+  /** Pawn velocity relative to the pivot */
+  FVector GetVelocity() const {
+    return (AngularVelocity ^ GetOffset()) + Direction * LengthRate;
+  }
+
+  bool NetSerialize(FArchive &Ar, UPackageMap *Map, bool &bOutSuccess) {
+    // Direction as polar (from straight down) + azimuth, 16 bits each
+    uint16 QTheta = 0;
+    uint16 QPhi = 0;
+    uint16 QLength = 0;
+    int16 QLengthRate = 0;
+    int16 QOmega[3] = {0, 0, 0};
+    uint16 QYaw = 0;
+
+    // Rates in 1/1000 rad/s: +-32 rad/s is far beyond any swing
+    constexpr float OmegaScale = 1000.f;
+
+    if (Ar.IsSaving()) {
+      const FVector Dir = Direction.GetSafeNormal(UE_SMALL_NUMBER,
+                                                  -FVector::UpVector);
+      const float Theta = FMath::Acos(FMath::Clamp(-Dir.Z, -1.f, 1.f));
+      const float Phi = FMath::Atan2(Dir.Y, Dir.X);
+      QTheta = uint16(FMath::RoundToInt(Theta / PI * MAX_uint16));
+      QPhi = uint16(FMath::RoundToInt((Phi + PI) / (2.f * PI) * MAX_uint16));
+      QLength = uint16(FMath::Clamp(FMath::RoundToInt(Length), 0, MAX_uint16));
+      QLengthRate = int16(
+          FMath::Clamp(FMath::RoundToInt(LengthRate), MIN_int16, MAX_int16));
+      for (int32 i = 0; i < 3; ++i) {
+        QOmega[i] = int16(FMath::Clamp(
+            FMath::RoundToInt(AngularVelocity[i] * OmegaScale), MIN_int16,
+            MAX_int16));
+      }
+      QYaw = FRotator::CompressAxisToShort(Yaw);
+    }
+
+    Ar << PivotId << QTheta << QPhi << QLength << QLengthRate;
+    Ar << QOmega[0] << QOmega[1] << QOmega[2] << QYaw;
+
+    if (Ar.IsLoading()) {
+      const float Theta = float(QTheta) / MAX_uint16 * PI;
+      const float Phi = float(QPhi) / MAX_uint16 * 2.f * PI - PI;
+      const float SinTheta = FMath::Sin(Theta);
+      Direction = FVector(SinTheta * FMath::Cos(Phi),
+                          SinTheta * FMath::Sin(Phi), -FMath::Cos(Theta));
+      Length = QLength;
+      LengthRate = QLengthRate;
+      AngularVelocity =
+          FVector(QOmega[0], QOmega[1], QOmega[2]) / OmegaScale;
+      Yaw = FRotator::DecompressAxisFromShort(QYaw);
+    }
+
+    bOutSuccess = true;
+    return true;
+  }
+};
+
+template <>
+struct TStructOpsTypeTraits<FRopePendulumState>
+    : public TStructOpsTypeTraitsBase2<FRopePendulumState> {
+  enum { WithNetSerializer = true };
+};
@@ -1,6 +1,7 @@
 #include "TPSAimingComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "DrawDebugHelpers.h"
+#include "HookableTargetSubsystem.h"
 
 UTPSAimingComponent::UTPSAimingComponent()
 {
@@ -10,6 +11,12 @@ UTPSAimingComponent::UTPSAimingComponent()
 void UTPSAimingComponent::BeginPlay()
 {
 	Super::BeginPlay();
+
+	// Make sure the registry indexes our tag (no-op for the default one)
+	if (UHookableTargetSubsystem* Registry = GetWorld()->GetSubsystem<UHookableTargetSubsystem>())
+	{
+		Registry->AddIndexedTag(HookableTag);
+	}
 }
 
 void UTPSAimingComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -17,20 +24,26 @@ void UTPSAimingComponent::TickComponent(float DeltaTime, ELevelTick TickType, FA
 	// Call base tick (performs basic line/sphere trace)
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-	// Update magnetism if aiming
-	if (bIsAiming)
+	// Update magnetism / focus lock if aiming (one registry query for both)
+	FVector CamLoc;
+	FRotator CamRot;
+	if (bIsAiming && GetView(CamLoc, CamRot))
 	{
-		UpdateMagnetism(DeltaTime);
+		const FVector CamForward = CamRot.Vector();
+		QueryHookableCandidates(CamLoc, CamForward);
+		UpdateMagnetism(DeltaTime, CamLoc, CamForward);
+		FocusedActor = bIsFocusing ? FindBestTarget(CamLoc, CamForward, FocusConeAngle) : nullptr;
 	}
 	else
 	{
 		bHasMagnetizedTarget = false;
 		CurrentMagnetizedActor = nullptr;
+		FocusedActor = nullptr;
 	}
 }
 
 
-void UTPSAimingComponent::UpdateMagnetism(float DeltaTime)
+void UTPSAimingComponent::UpdateMagnetism(float DeltaTime, const FVector& CamLoc, const FVector& CamForward)
 {
 	if (!bEnableMagnetism)
 	{
@@ -39,16 +52,8 @@ void UTPSAimingComponent::UpdateMagnetism(float DeltaTime)
 		return;
 	}
 
-	APlayerController* PC = UGameplayStatics::GetPlayerController(this, 0);
-	if (!PC) return;
-
-	FVector CamLoc;
-	FRotator CamRot;
-	PC->GetPlayerViewPoint(CamLoc, CamRot);
-	FVector CamForward = CamRot.Vector();
-
 	// Find best target
-	AActor* BestTarget = FindBestMagnetismTarget(CamLoc, CamForward);
+	AActor* BestTarget = FindBestTarget(CamLoc, CamForward, MagnetismConeAngle);
 
 	if (BestTarget)
 	{
@@ -94,31 +99,39 @@ void UTPSAimingComponent::UpdateMagnetism(float DeltaTime)
 	}
 }
 
-AActor* UTPSAimingComponent::FindBestMagnetismTarget(const FVector& CamLoc, const FVector& CamForward) const
+void UTPSAimingComponent::QueryHookableCandidates(const FVector& CamLoc, const FVector& CamForward)
 {
-	TArray<AActor*> HookableActors;
-	UGameplayStatics::GetAllActorsWithTag(GetWorld(), HookableTag, HookableActors);
+	HookableCandidates.Reset();
+
+	const UHookableTargetSubsystem* Registry = GetWorld()->GetSubsystem<UHookableTargetSubsystem>();
+	if (!Registry) return;
+
+	const float ConeAngle = FMath::Max(
+		bEnableMagnetism ? MagnetismConeAngle : 0.0f,
+		bIsFocusing ? FocusConeAngle : 0.0f);
+	if (ConeAngle <= 0.0f) return;
+
+	// Range and cone are resolved by the registry (spatial hash + dot test),
+	// only the few candidates inside the cone are scored here
+	Registry->QueryCone(CamLoc, CamForward, ConeAngle, MagnetismRange, HookableTag, HookableCandidates);
+}
 
+AActor* UTPSAimingComponent::FindBestTarget(const FVector& CamLoc, const FVector& CamForward, float ConeAngle) const
+{
 	AActor* BestTarget = nullptr;
 	float BestScore = FLT_MAX;
 
-	for (AActor* Actor : HookableActors)
+	for (AActor* Actor : HookableCandidates)
 	{
-		if (!Actor) continue;
-
 		FVector ToTarget = Actor->GetActorLocation() - CamLoc;
 		float Distance = ToTarget.Size();
 
-		// Check range
-		if (Distance > MagnetismRange) continue;
-
-		// Check cone angle
 		FVector ToTargetNorm = ToTarget.GetSafeNormal();
 		float DotProduct = FVector::DotProduct(CamForward, ToTargetNorm);
-		float AngleRad = FMath::Acos(DotProduct);
-		float AngleDeg = FMath::RadiansToDegrees(AngleRad);
+		float AngleDeg = FMath::RadiansToDegrees(FMath::Acos(FMath::Clamp(DotProduct, -1.0f, 1.0f)));
 
-		if (AngleDeg > MagnetismConeAngle) continue;
+		// Candidates come from the widest cone
+		if (AngleDeg > ConeAngle) continue;
 
 		// Score: prefer closer and more centered targets
 		float Score = Distance + (AngleDeg * 100.0f);
@@ -135,6 +148,12 @@ AActor* UTPSAimingComponent::FindBestMagnetismTarget(const FVector& CamLoc, cons
 
 FVector UTPSAimingComponent::GetTargetLocation() const
 {
+	// Focus locks onto the hookable itself (exact point for the charge solve)
+	if (FocusedActor)
+	{
+		return FocusedActor->GetActorLocation();
+	}
+
 	// Return magnetized target if available
 	if (bHasMagnetizedTarget)
 	{
@@ -147,15 +166,17 @@ FVector UTPSAimingComponent::GetTargetLocation() const
 
 FVector UTPSAimingComponent::GetAimDirection() const
 {
-	APlayerController* PC = UGameplayStatics::GetPlayerController(this, 0);
-	if (!PC)
+	FVector CamLoc;
+	FRotator CamRot;
+	if (!GetView(CamLoc, CamRot))
 	{
 		return FVector::ForwardVector;
 	}
 
-	FVector CamLoc;
-	FRotator CamRot;
-	PC->GetPlayerViewPoint(CamLoc, CamRot);
+	if (FocusedActor)
+	{
+		return (FocusedActor->GetActorLocation() - CamLoc).GetSafeNormal();
+	}
 
 	// Use magnetized target if available
 	FVector TargetLoc = bHasMagnetizedTarget ? MagnetizedTargetLocation : CurrentTargetLocation;
@@ -184,5 +205,6 @@ void UTPSAimingComponent::StartFocus()
 void UTPSAimingComponent::StopFocus()
 {
 	bIsFocusing = false;
+	FocusedActor = nullptr;
 	// Note: we don't stop aiming, that's controlled separately
 }
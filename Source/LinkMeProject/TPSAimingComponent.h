@@ -60,9 +60,22 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TPS Magnetism")
 	FName HookableTag = TEXT("Hookable");
 
+	/** Focus mode locks onto the best hookable target in this cone (degrees), even with magnetism off */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TPS Magnetism", meta=(ClampMin="0", ClampMax="90"))
+	float FocusConeAngle = 5.0f;
+
+	/** Hookable target locked by focus mode (null if none in the focus cone) */
+	UFUNCTION(BlueprintPure, Category = "TPS Aiming")
+	AActor* GetFocusedActor() const { return FocusedActor; }
+
 protected:
-	void UpdateMagnetism(float DeltaTime);
-	AActor* FindBestMagnetismTarget(const FVector& CamLoc, const FVector& CamForward) const;
+	void UpdateMagnetism(float DeltaTime, const FVector& CamLoc, const FVector& CamForward);
+
+	/** Fill HookableCandidates from the registry (widest of the magnetism / focus cones) */
+	void QueryHookableCandidates(const FVector& CamLoc, const FVector& CamForward);
+
+	/** Best scored candidate within ConeAngle of CamForward */
+	AActor* FindBestTarget(const FVector& CamLoc, const FVector& CamForward, float ConeAngle) const;
 
 	// Magnetism state
 	FVector MagnetizedTargetLocation;
@@ -73,4 +86,10 @@ protected:
 
 	// Focus state
 	bool bIsFocusing = false;
+
+	UPROPERTY()
+	AActor* FocusedActor = nullptr;
+
+	// Registry results for this tick, shared by magnetism and focus (reused)
+	TArray<AActor*> HookableCandidates;
 };
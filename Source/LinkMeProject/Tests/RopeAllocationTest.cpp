@@ -0,0 +1,107 @@
+// RopeAllocationTest.cpp
+// The steady-state rope tick (visual update + render simulation) must not
+// grow the rope's heap memory
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Misc/MemStack.h"
+#include "RopeRenderComponent.h"
+#include "RopeSystemComponent.h"
+
+// Per-tick scratch lives inline or on the frame's memory stack
+static_assert(std::is_same_v<TRopeScratchArray<FVector>::AllocatorType,
+                             TInlineAllocator<32>>,
+              "Rope scratch arrays must stay inline");
+static_assert(std::is_same_v<FRopeFramePointArray::AllocatorType,
+                             TMemStackAllocator<>>,
+              "Rendered points must stay on the frame memory stack");
+
+namespace {
+
+constexpr float TickDeltaTime = 1.f / 60.f;
+
+// First ticks build the particles, spline points and segment pool
+constexpr int32 WarmUpTicks = 8;
+constexpr int32 MeasuredTicks = 32;
+
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FRopeTickAllocationTest, "LinkMe.Rope.SteadyStateTickAllocations",
+    EAutomationTestFlags_ApplicationContextMask |
+        EAutomationTestFlags::EngineFilter)
+
+bool FRopeTickAllocationTest::RunTest(const FString &Parameters) {
+  // No scene or physics: the test covers the rope code, not the renderer
+  // or the collision queries it issues
+  const UWorld::InitializationValues IVS = UWorld::InitializationValues()
+                                               .InitializeScenes(false)
+                                               .CreatePhysicsScene(false)
+                                               .CreateNavigation(false)
+                                               .CreateAISystem(false)
+                                               .AllowAudioPlayback(false)
+                                               .SetTransactional(false);
+  UWorld *World =
+      UWorld::CreateWorld(EWorldType::Game, false, NAME_None, nullptr, true,
+                          ERHIFeatureLevel::Num, &IVS);
+  if (!TestNotNull(TEXT("World"), World))
+    return false;
+
+  AActor *Owner = World->SpawnActor<AActor>();
+  URopeRenderComponent *Render = NewObject<URopeRenderComponent>(Owner);
+  Render->RegisterComponent();
+  URopeSystemComponent *RopeSystem = NewObject<URopeSystemComponent>(Owner);
+  RopeSystem->RegisterComponent();
+
+  // Attached rope, anchor -> player, the player swinging below the anchor
+  RopeSystem->RopeState = ERopeState::Attached;
+  RopeSystem->BendPoints = {FVector(0.f, 0.f, 1000.f),
+                            FVector(600.f, 0.f, 200.f)};
+
+  const auto Tick = [RopeSystem, Render](int32 Frame) {
+    const float Angle = float(Frame) * TickDeltaTime;
+    RopeSystem->BendPoints.Last() =
+        FVector(600.f * FMath::Cos(Angle), 600.f * FMath::Sin(Angle), 200.f);
+    RopeSystem->UpdateRopeVisual();
+    Render->StepSimulation(TickDeltaTime);
+  };
+
+  int32 Frame = 0;
+  for (; Frame < WarmUpTicks; ++Frame) {
+    Tick(Frame);
+  }
+  TestTrue(TEXT("Rope is active after warm-up"), Render->IsRopeActive());
+
+  // The rope's heap buffers, as reported to the engine's memory stats (obj
+  // list, memreport). Counting GMalloc calls would need the allocator swapped
+  // under the other threads.
+  const auto HeapBytes = [RopeSystem, Render]() {
+    return static_cast<int64>(
+        Render->GetResourceSizeBytes(EResourceSizeMode::Exclusive) +
+        RopeSystem->BendPoints.GetAllocatedSize() +
+        RopeSystem->BendPointNormals.GetAllocatedSize() +
+        RopeSystem->BendPointAnchors.GetAllocatedSize());
+  };
+  const int64 HeapBytesBefore = HeapBytes();
+  const int32 MemStackBytesBefore = FMemStack::Get().GetByteCount();
+
+  for (; Frame < WarmUpTicks + MeasuredTicks; ++Frame) {
+    Tick(Frame);
+  }
+
+  TestEqual(TEXT("Rope heap memory across steady-state ticks"),
+            HeapBytes(), HeapBytesBefore);
+  TestEqual(TEXT("Frame memory stack released after each tick"),
+            FMemStack::Get().GetByteCount(), MemStackBytesBefore);
+
+  World->DestroyWorld(false);
+  World->RemoveFromRoot();
+  return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS